@@ -36,18 +36,24 @@ namespace ResultsComparer
                 new[] { "--filter", "-f" }, "Filter the benchmarks by name using glob pattern(s).");
             Option<bool> fullId = new Option<bool>(
                 new[] { "--full-id" }, "Display the full benchmark name id.");
+            Option<bool> failOnRegression = new Option<bool>(
+                new[] { "--fail-on-regression" }, "Return a non zero exit code when a benchmark is slower than the base results.");
 
             RootCommand rootCommand = new RootCommand
             {
-                basePath, diffPath, threshold.AsRequired(), noise, top, filters, fullId
+                basePath, diffPath, threshold.AsRequired(), noise, top, filters, fullId, failOnRegression
             };
 
-            rootCommand.SetHandler<string, string, string, string, int?, string[], bool>(
-                static (basePath, diffPath, threshold, noise, top, filters, fullId) =>
+            rootCommand.SetHandler<string, string, string, string, int?, string[], bool, bool>(
+                static (basePath, diffPath, threshold, noise, top, filters, fullId, failOnRegression) =>
                 {
-                    if (TryParseThresholds(threshold, noise, out var testThreshold, out var noiseThreshold))
+                    if (!TryParseThresholds(threshold, noise, out var testThreshold, out var noiseThreshold))
                     {
-                        TwoInputsComparer.Compare(new TwoInputsOptions
+                        Environment.ExitCode = 1;
+                    }
+                    else
+                    {
+                        var regressionCount = TwoInputsComparer.Compare(new TwoInputsOptions
                         {
                             BasePath = basePath,
                             DiffPath = diffPath,
@@ -57,9 +63,15 @@ namespace ResultsComparer
                             Filters = GetFilters(filters),
                             FullId = fullId
                         });
+
+                        if (failOnRegression && regressionCount > 0)
+                        {
+                            Console.WriteLine($"{regressionCount} benchmark(s) regressed past the threshold {testThreshold}.");
+                            Environment.ExitCode = 1;
+                        }
                     }
                 },
-                basePath, diffPath, threshold, noise, top, filters, fullId);
+                basePath, diffPath, threshold, noise, top, filters, fullId, failOnRegression);
 
             Option<DirectoryInfo> input = new Option<DirectoryInfo>(
                 new[] { "--input", "-i" }, "Path to the Input folder with BenchmarkDotNet .json files.");
@@ -115,7 +127,8 @@ namespace ResultsComparer
 
             matrixCommand.AddCommand(decompressCommand);
 
-            return rootCommand.Invoke(args);
+            var exitCode = rootCommand.Invoke(args);
+            return exitCode != 0 ? exitCode : Environment.ExitCode;
         }
 
         private static bool TryParseThresholds(string test, string noise, out Threshold testThreshold, out Threshold noiseThreshold)
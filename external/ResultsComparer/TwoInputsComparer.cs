@@ -11,20 +11,23 @@ namespace ResultsComparer;
 
 internal static class TwoInputsComparer
 {
-    internal static void Compare(TwoInputsOptions args)
+    // Returns the number of benchmarks that are slower than the base results
+    internal static int Compare(TwoInputsOptions args)
     {
         var notSame = GetNotSameResults(args).ToArray();
 
         if (!notSame.Any())
         {
             Console.WriteLine($"No differences found between the benchmark results with threshold {args.StatisticalTestThreshold}.");
-            return;
+            return 0;
         }
 
         PrintSummary(notSame);
 
         PrintTable(notSame, EquivalenceTestConclusion.Slower, args);
         PrintTable(notSame, EquivalenceTestConclusion.Faster, args);
+
+        return notSame.Count(result => result.conclusion == EquivalenceTestConclusion.Slower);
     }
 
     private static IEnumerable<(string id, Benchmark baseResult, Benchmark diffResult, EquivalenceTestConclusion conclusion)> GetNotSameResults(TwoInputsOptions args)
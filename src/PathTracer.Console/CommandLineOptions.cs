@@ -0,0 +1,314 @@
+using System.Globalization;
+
+namespace PathTracer.Console;
+
+public readonly record struct CommandLineOptions
+{
+    public CommandLineOptions()
+    {
+        Width = 800;
+        Height = 450;
+        SampleCount = 1;
+        OutputPath = "./TestData/OutputConsole.png";
+        OutputFormat = OutputFormat.Png;
+        RenderOptions = new RenderOptions();
+        WorkerTimeout = 120.0;
+    }
+
+    public int Width { get; init; }
+    public int Height { get; init; }
+    public int SampleCount { get; init; }
+
+    // NOTE: 0 renders all the samples
+    public double TimeBudget { get; init; }
+
+    // NOTE: 0 renders the whole image at once, otherwise bands of rows are rendered and streamed to the output
+    public int BandHeight { get; init; }
+    public string? ScenePath { get; init; }
+    public string? ExportScenePath { get; init; }
+    public string OutputPath { get; init; }
+    public OutputFormat OutputFormat { get; init; }
+    public RenderOptions RenderOptions { get; init; }
+
+    // NOTE: Distributed rendering, the coordinator listens on ListenPort when it is set and
+    // on a local port for its local workers otherwise
+    public string? WorkerHost { get; init; }
+    public int WorkerPort { get; init; }
+    public int? ListenPort { get; init; }
+    public int LocalWorkerCount { get; init; }
+    public double WorkerTimeout { get; init; }
+    public bool IsWorker => WorkerHost is not null;
+    public bool IsCoordinator => ListenPort is not null || LocalWorkerCount > 0;
+    public bool IsJsonOutput { get; init; }
+    public bool IsHelp { get; init; }
+
+    public const string Usage = """
+        Usage: PathTracer.Console [options]
+
+          --width <pixels>          Output width (default: 800)
+          --height <pixels>         Output height (default: 450)
+          --samples <count>         Samples per pixel (default: 1)
+          --max-bounces <count>     Maximum bounce count per path (default: 8)
+          --roulette-bounces <count> Bounce count after which the Russian roulette can end paths, 0 starts at the first hit (default: 3)
+          --threads <count>         Worker thread count, 0 uses all the logical processors (default: 0)
+          --tile-size <pixels>      Tile size (default: 32)
+          --tile-order <order>      Scanline, Morton or Spiral (default: Morton)
+          --mode <mode>             PerPixel or Wavefront (default: PerPixel)
+          --tone-mapping <operator> Clamp, Reinhard or Aces (default: Clamp)
+          --error-threshold <value> Stop sampling blocks of pixels once their relative error is below the value, 0 disables adaptive sampling (default: 0)
+          --no-jitter               Trace every sample through the corner of its pixel instead of a random point
+          --denoise                 Filter the image with the denoiser before writing it
+          --time-budget <seconds>   Stop rendering new samples after the given time, 0 disables the budget (default: 0)
+          --scene <path>            Text scene file or binary .ptscene file, the built-in scene is used when omitted
+          --export-scene <path>     Write the scene with a prebuilt acceleration structure to a binary .ptscene file and exit
+          --output <path>           Output image path (default: ./TestData/OutputConsole.png)
+          --band-height <rows>      Render bands of rows and stream them to a Png output, 0 renders the whole image at once (default: 0)
+          --format <format>         Png, Bmp, Jpeg, Tga or Webp (default: from the output extension)
+          --listen <port>           Coordinate a distributed render, workers connect to this port
+          --local-workers <count>   Coordinate a distributed render with the given number of local worker processes
+          --worker-timeout <seconds> Drop workers that send nothing within the timeout (default: 120)
+          --worker <host:port>      Run as a worker of the coordinator at the given address
+          --json                    Only print the render report as a single JSON line
+          --help                    Show this help
+        """;
+
+    public static CommandLineOptions Parse(string[] arguments)
+    {
+        ArgumentNullException.ThrowIfNull(arguments);
+
+        var options = new CommandLineOptions();
+        var renderOptions = options.RenderOptions;
+        var hasOutputFormat = false;
+
+        for (var i = 0; i < arguments.Length; i++)
+        {
+            var argument = arguments[i];
+
+            switch (argument)
+            {
+                case "--width":
+                    options = options with { Width = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--height":
+                    options = options with { Height = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--samples":
+                    options = options with { SampleCount = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--max-bounces":
+                    renderOptions = renderOptions with { MaxBounceCount = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--roulette-bounces":
+                    renderOptions = renderOptions with { RussianRouletteBounceCount = ReadInt(arguments, ref i) };
+                    break;
+
+                case "--threads":
+                    renderOptions = renderOptions with { ThreadCount = ReadInt(arguments, ref i) };
+                    break;
+
+                case "--tile-size":
+                    renderOptions = renderOptions with { TileSize = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--tile-order":
+                    renderOptions = renderOptions with { TileOrder = ReadEnum<TileOrder>(arguments, ref i) };
+                    break;
+
+                case "--mode":
+                    renderOptions = renderOptions with { RenderMode = ReadEnum<RenderMode>(arguments, ref i) };
+                    break;
+
+                case "--tone-mapping":
+                    renderOptions = renderOptions with { ToneMappingOperator = ReadEnum<ToneMappingOperator>(arguments, ref i) };
+                    break;
+
+                case "--error-threshold":
+                    renderOptions = renderOptions with { AdaptiveErrorThreshold = (float)ReadDouble(arguments, ref i) };
+                    break;
+
+                case "--no-jitter":
+                    renderOptions = renderOptions with { IsJitterEnabled = false };
+                    break;
+
+                case "--denoise":
+                    renderOptions = renderOptions with { IsDenoiserEnabled = true };
+                    break;
+
+                case "--time-budget":
+                    options = options with { TimeBudget = ReadDouble(arguments, ref i) };
+                    break;
+
+                case "--scene":
+                    options = options with { ScenePath = ReadValue(arguments, ref i) };
+                    break;
+
+                case "--export-scene":
+                    options = options with { ExportScenePath = ReadValue(arguments, ref i) };
+                    break;
+
+                case "--output":
+                    options = options with { OutputPath = ReadValue(arguments, ref i) };
+                    break;
+
+                case "--band-height":
+                    options = options with { BandHeight = ReadInt(arguments, ref i) };
+                    break;
+
+                case "--format":
+                    options = options with { OutputFormat = ReadEnum<OutputFormat>(arguments, ref i) };
+                    hasOutputFormat = true;
+                    break;
+
+                case "--listen":
+                    options = options with { ListenPort = ReadInt(arguments, ref i) };
+                    break;
+
+                case "--local-workers":
+                    options = options with { LocalWorkerCount = ReadPositiveInt(arguments, ref i) };
+                    break;
+
+                case "--worker-timeout":
+                    options = options with { WorkerTimeout = ReadDouble(arguments, ref i) };
+                    break;
+
+                case "--worker":
+                    var (workerHost, workerPort) = ReadAddress(arguments, ref i);
+                    options = options with { WorkerHost = workerHost, WorkerPort = workerPort };
+                    break;
+
+                case "--json":
+                    options = options with { IsJsonOutput = true };
+                    break;
+
+                case "--help":
+                    options = options with { IsHelp = true };
+                    break;
+
+                default:
+                    throw new ArgumentException($"Unknown option '{argument}'.", nameof(arguments));
+            }
+        }
+
+        if (!hasOutputFormat)
+        {
+            options = options with { OutputFormat = GetOutputFormat(options.OutputPath) };
+        }
+
+        if (options.BandHeight > 0 && options.OutputFormat != OutputFormat.Png)
+        {
+            throw new ArgumentException("Option '--band-height' only supports the Png output format.", nameof(arguments));
+        }
+
+        if (options.IsCoordinator && (options.BandHeight > 0 || options.TimeBudget > 0.0 || renderOptions.AdaptiveErrorThreshold > 0.0f || renderOptions.IsDenoiserEnabled))
+        {
+            throw new ArgumentException("Distributed renders don't support '--band-height', '--time-budget', '--error-threshold' and '--denoise'.", nameof(arguments));
+        }
+
+        // NOTE: The denoiser needs the neighbours of every pixel, which are in other bands
+        if (options.BandHeight > 0 && renderOptions.IsDenoiserEnabled)
+        {
+            throw new ArgumentException("Option '--denoise' cannot be used with '--band-height'.", nameof(arguments));
+        }
+
+        if (options.ListenPort > ushort.MaxValue)
+        {
+            throw new ArgumentException("Option '--listen' requires a valid port.", nameof(arguments));
+        }
+
+        if (options.WorkerTimeout <= 0.0)
+        {
+            throw new ArgumentException("Option '--worker-timeout' cannot be 0.", nameof(arguments));
+        }
+
+        return options with { RenderOptions = renderOptions };
+    }
+
+    private static OutputFormat GetOutputFormat(string outputPath)
+    {
+        return Path.GetExtension(outputPath).ToUpperInvariant() switch
+        {
+            ".BMP" => OutputFormat.Bmp,
+            ".JPG" or ".JPEG" => OutputFormat.Jpeg,
+            ".TGA" => OutputFormat.Tga,
+            ".WEBP" => OutputFormat.Webp,
+            _ => OutputFormat.Png
+        };
+    }
+
+    private static string ReadValue(string[] arguments, ref int index)
+    {
+        if (index + 1 >= arguments.Length)
+        {
+            throw new ArgumentException($"Option '{arguments[index]}' requires a value.", nameof(arguments));
+        }
+
+        return arguments[++index];
+    }
+
+    private static int ReadInt(string[] arguments, ref int index)
+    {
+        var option = arguments[index];
+
+        if (!int.TryParse(ReadValue(arguments, ref index), NumberStyles.Integer, CultureInfo.InvariantCulture, out var value) || value < 0)
+        {
+            throw new ArgumentException($"Option '{option}' requires a positive integer value.", nameof(arguments));
+        }
+
+        return value;
+    }
+
+    private static (string Host, int Port) ReadAddress(string[] arguments, ref int index)
+    {
+        var option = arguments[index];
+        var address = ReadValue(arguments, ref index);
+        var separatorIndex = address.LastIndexOf(':');
+
+        if (separatorIndex <= 0 || !int.TryParse(address.AsSpan(separatorIndex + 1), NumberStyles.Integer, CultureInfo.InvariantCulture, out var port) || port <= 0 || port > ushort.MaxValue)
+        {
+            throw new ArgumentException($"Option '{option}' requires a host:port value.", nameof(arguments));
+        }
+
+        return (address[..separatorIndex], port);
+    }
+
+    private static double ReadDouble(string[] arguments, ref int index)
+    {
+        var option = arguments[index];
+
+        if (!double.TryParse(ReadValue(arguments, ref index), NumberStyles.Float, CultureInfo.InvariantCulture, out var value) || !double.IsFinite(value) || value < 0.0)
+        {
+            throw new ArgumentException($"Option '{option}' requires a positive number value.", nameof(arguments));
+        }
+
+        return value;
+    }
+
+    private static int ReadPositiveInt(string[] arguments, ref int index)
+    {
+        var option = arguments[index];
+        var value = ReadInt(arguments, ref index);
+
+        if (value == 0)
+        {
+            throw new ArgumentException($"Option '{option}' cannot be 0.", nameof(arguments));
+        }
+
+        return value;
+    }
+
+    private static T ReadEnum<T>(string[] arguments, ref int index) where T : struct, Enum
+    {
+        var option = arguments[index];
+
+        if (!Enum.TryParse<T>(ReadValue(arguments, ref index), ignoreCase: true, out var value) || !Enum.IsDefined(value))
+        {
+            throw new ArgumentException($"Option '{option}' must be one of: {string.Join(", ", Enum.GetNames<T>())}.", nameof(arguments));
+        }
+
+        return value;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Console;
+
+// NOTE: Binary messages exchanged between the coordinator and the workers over TCP. Every
+// message starts with its type, values are little endian and structs are sent with their
+// raw memory layout, so the coordinator and the workers must run the same build.
+//
+// Worker:      Hello, then a Progress message per sample and one RegionResult per RenderRegion
+// Coordinator: Job, then RenderRegion messages until Done
+public static class DistributedProtocol
+{
+    private const uint Magic = 0x52445450; // "PTDR"
+    private const int Version = 4;
+
+    public static void WriteHello(BinaryWriter writer)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        writer.Write((int)MessageType.Hello);
+        writer.Write(Magic);
+        writer.Write(Version);
+    }
+
+    public static void ReadHello(BinaryReader reader)
+    {
+        ReadMessageType(reader, MessageType.Hello);
+
+        if (reader.ReadUInt32() != Magic)
+        {
+            throw new InvalidDataException("Peer is not a path tracer worker.");
+        }
+
+        var version = reader.ReadInt32();
+
+        if (version != Version)
+        {
+            throw new InvalidDataException($"Worker protocol version {version} is not supported, expected version {Version}.");
+        }
+    }
+
+    public static void WriteJob(BinaryWriter writer, RenderJob job)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        var renderOptions = job.RenderOptions;
+
+        writer.Write((int)MessageType.Job);
+        writer.Write(job.Width);
+        writer.Write(job.Height);
+        writer.Write(job.SampleCount);
+        writer.Write(Unsafe.SizeOf<RenderOptions>());
+        writer.Write(MemoryMarshal.AsBytes(new ReadOnlySpan<RenderOptions>(in renderOptions)));
+        writer.Write(job.SceneData.Length);
+        writer.Write(job.SceneData.Span);
+    }
+
+    public static RenderJob ReadJob(BinaryReader reader)
+    {
+        ReadMessageType(reader, MessageType.Job);
+
+        var width = reader.ReadInt32();
+        var height = reader.ReadInt32();
+        var sampleCount = reader.ReadInt32();
+
+        if (width <= 0 || height <= 0 || sampleCount <= 0)
+        {
+            throw new InvalidDataException("Job has an invalid image size or sample count.");
+        }
+
+        if (reader.ReadInt32() != Unsafe.SizeOf<RenderOptions>())
+        {
+            throw new InvalidDataException("Job was sent with a different memory layout.");
+        }
+
+        var renderOptions = new RenderOptions();
+        ReadExactly(reader, MemoryMarshal.AsBytes(new Span<RenderOptions>(ref renderOptions)));
+
+        var sceneData = new byte[ReadLength(reader)];
+        ReadExactly(reader, sceneData);
+
+        return new RenderJob
+        {
+            Width = width,
+            Height = height,
+            SampleCount = sampleCount,
+            RenderOptions = renderOptions,
+            SceneData = sceneData
+        };
+    }
+
+    public static void WriteRenderRegion(BinaryWriter writer, int regionIndex, Tile region)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        writer.Write((int)MessageType.RenderRegion);
+        writer.Write(regionIndex);
+        writer.Write(region.X);
+        writer.Write(region.Y);
+        writer.Write(region.Width);
+        writer.Write(region.Height);
+    }
+
+    public static (int RegionIndex, Tile Region) ReadRenderRegion(BinaryReader reader)
+    {
+        ArgumentNullException.ThrowIfNull(reader);
+
+        var regionIndex = reader.ReadInt32();
+        var region = new Tile
+        {
+            X = reader.ReadInt32(),
+            Y = reader.ReadInt32(),
+            Width = reader.ReadInt32(),
+            Height = reader.ReadInt32()
+        };
+
+        if (region.Width <= 0 || region.Height <= 0)
+        {
+            throw new InvalidDataException("Region cannot be empty.");
+        }
+
+        return (regionIndex, region);
+    }
+
+    public static void WriteRegionResult(BinaryWriter writer, int regionIndex, AccumulationBuffer accumulationBuffer, RenderCounterValues counters)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+        ArgumentNullException.ThrowIfNull(accumulationBuffer);
+
+        writer.Write((int)MessageType.RegionResult);
+        writer.Write(regionIndex);
+        writer.Write(accumulationBuffer.FrameCount);
+        writer.Write(MemoryMarshal.AsBytes(new ReadOnlySpan<RenderCounterValues>(in counters)));
+        writer.Write(accumulationBuffer.Samples.Length);
+        writer.Write(MemoryMarshal.AsBytes(accumulationBuffer.Samples));
+    }
+
+    public static RegionResult ReadRegionResult(BinaryReader reader)
+    {
+        ArgumentNullException.ThrowIfNull(reader);
+
+        var regionIndex = reader.ReadInt32();
+        var frameCount = reader.ReadInt32();
+        var counters = new RenderCounterValues();
+        ReadExactly(reader, MemoryMarshal.AsBytes(new Span<RenderCounterValues>(ref counters)));
+
+        var samples = new Vector4[ReadLength(reader)];
+
+        ReadExactly(reader, MemoryMarshal.AsBytes(samples.AsSpan()));
+
+        return new RegionResult
+        {
+            RegionIndex = regionIndex,
+            FrameCount = frameCount,
+            Counters = counters,
+            Samples = samples
+        };
+    }
+
+    public static void WriteProgress(BinaryWriter writer, int regionIndex, int sampleCount)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+
+        writer.Write((int)MessageType.Progress);
+        writer.Write(regionIndex);
+        writer.Write(sampleCount);
+    }
+
+    public static (int RegionIndex, int SampleCount) ReadProgress(BinaryReader reader)
+    {
+        ArgumentNullException.ThrowIfNull(reader);
+
+        return (reader.ReadInt32(), reader.ReadInt32());
+    }
+
+    public static void WriteDone(BinaryWriter writer)
+    {
+        ArgumentNullException.ThrowIfNull(writer);
+        writer.Write((int)MessageType.Done);
+    }
+
+    public static MessageType ReadMessageType(BinaryReader reader)
+    {
+        ArgumentNullException.ThrowIfNull(reader);
+
+        var messageType = (MessageType)reader.ReadInt32();
+
+        if (!Enum.IsDefined(messageType))
+        {
+            throw new InvalidDataException($"Unknown message type {(int)messageType}.");
+        }
+
+        return messageType;
+    }
+
+    private static void ReadMessageType(BinaryReader reader, MessageType expectedMessageType)
+    {
+        var messageType = ReadMessageType(reader);
+
+        if (messageType != expectedMessageType)
+        {
+            throw new InvalidDataException($"Expected a {expectedMessageType} message but received a {messageType} message.");
+        }
+    }
+
+    private static int ReadLength(BinaryReader reader)
+    {
+        var length = reader.ReadInt32();
+
+        if (length < 0)
+        {
+            throw new InvalidDataException("Message has a negative length.");
+        }
+
+        return length;
+    }
+
+    // NOTE: BinaryReader doesn't read ahead so the base stream can be read directly
+    private static void ReadExactly(BinaryReader reader, Span<byte> destination)
+    {
+        reader.BaseStream.ReadExactly(destination);
+    }
+}
\ No newline at end of file
@@ -6,10 +6,12 @@ public readonly record struct FileImage : IImage
     {
         Width = 0;
         Height = 0;
-        ImageData = Array.Empty<Vector4>();
+        AccumulationBuffer = new AccumulationBuffer(0, 0);
     }
 
     public int Width { get; init; }
     public int Height { get; init; }
-    public Memory<Vector4> ImageData { get; init; }
+    public AccumulationBuffer AccumulationBuffer { get; init; }
+    public ToneMappingOperator ToneMappingOperator { get; init; }
+    public OutputFormat OutputFormat { get; init; }
 }
\ No newline at end of file
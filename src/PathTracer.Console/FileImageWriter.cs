@@ -1,47 +1,48 @@
+using System.Runtime.InteropServices;
 using SixLabors.ImageSharp;
+using SixLabors.ImageSharp.Formats;
+using SixLabors.ImageSharp.Formats.Bmp;
+using SixLabors.ImageSharp.Formats.Jpeg;
 using SixLabors.ImageSharp.Formats.Png;
+using SixLabors.ImageSharp.Formats.Tga;
+using SixLabors.ImageSharp.Formats.Webp;
 using SixLabors.ImageSharp.PixelFormats;
 
 namespace PathTracer.Console;
 
 public class FileImageWriter : IImageWriter<FileImage, string>
 {
-    private const float _gammaCorrection = 1.0f / 2.2f;
-
     public FileImageWriter()
     {
     }
 
-    public void StorePixel(FileImage image, int x, int y, Vector4 pixel)
-    {
-        var pixelRowIndex = (image.Height - 1 - y) * image.Width;
-        image.ImageData.Span[pixelRowIndex + x] = pixel;
-    }
-
     public void CommitImage(FileImage image, string outputPath)
     {
-        var outputImage = new Image<Rgb24>(image.Width, image.Height);
+        using var outputImage = new Image<Rgba32>(image.Width, image.Height);
 
-        for (var i = 0; i < image.Height; i++)
+        outputImage.ProcessPixelRows(accessor =>
         {
-            for (var j = 0; j < image.Width; j++)
+            for (var i = 0; i < accessor.Height; i++)
             {
-                var pixel = image.ImageData.Span[i * image.Width + j];
-
-                pixel = GammaCorrect(pixel);
-                pixel = Vector4.Clamp(pixel * 255.0f, Vector4.Zero, new Vector4(255.0f));
-            
-                outputImage[j, i] = new Rgb24((byte)pixel.X, (byte)pixel.Y, (byte)pixel.Z);
+                var outputRow = MemoryMarshal.Cast<Rgba32, uint>(accessor.GetRowSpan(i));
+                image.AccumulationBuffer.ResolveRow(image.Height - 1 - i, outputRow, image.ToneMappingOperator);
             }
-        }
+        });
 
         using var fileStream = new FileStream(outputPath, FileMode.Create);
-        var encoder = new PngEncoder();
+        var encoder = CreateEncoder(image.OutputFormat);
         encoder.Encode(outputImage, fileStream); 
     }
-    
-    private static Vector4 GammaCorrect(Vector4 pixel)
+
+    private static IImageEncoder CreateEncoder(OutputFormat outputFormat)
     {
-        return new Vector4(MathF.Pow(pixel.X, _gammaCorrection), MathF.Pow(pixel.Y, _gammaCorrection), MathF.Pow(pixel.Z, _gammaCorrection), pixel.W);
+        return outputFormat switch
+        {
+            OutputFormat.Bmp => new BmpEncoder(),
+            OutputFormat.Jpeg => new JpegEncoder(),
+            OutputFormat.Tga => new TgaEncoder(),
+            OutputFormat.Webp => new WebpEncoder(),
+            _ => new PngEncoder()
+        };
     }
 }
\ No newline at end of file
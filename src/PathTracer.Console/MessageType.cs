@@ -0,0 +1,11 @@
+namespace PathTracer.Console;
+
+public enum MessageType
+{
+    Hello,
+    Job,
+    RenderRegion,
+    RegionResult,
+    Done,
+    Progress
+}
\ No newline at end of file
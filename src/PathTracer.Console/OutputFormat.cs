@@ -0,0 +1,10 @@
+namespace PathTracer.Console;
+
+public enum OutputFormat
+{
+    Png,
+    Bmp,
+    Jpeg,
+    Tga,
+    Webp
+}
\ No newline at end of file
@@ -1,69 +1,340 @@
 ﻿using System.Diagnostics;
+using System.Globalization;
+using System.Net;
+using System.Net.Sockets;
+using System.Text.Json;
 
-Console.ForegroundColor = ConsoleColor.White;
-Console.WriteLine("Ray Trace Console");
+CommandLineOptions options;
 
-// TODO: Add parameters
+try
+{
+    options = CommandLineOptions.Parse(args);
+}
+catch (ArgumentException exception)
+{
+    Console.Error.WriteLine(exception.Message);
+    Console.Error.WriteLine(CommandLineOptions.Usage);
+    return 1;
+}
+
+if (options.IsHelp)
+{
+    Console.WriteLine(CommandLineOptions.Usage);
+    return 0;
+}
+
+// NOTE: Workers only write errors so the output of the coordinator stays readable
+if (options.IsWorker)
+{
+    try
+    {
+        RenderWorker.Run(options.WorkerHost!, options.WorkerPort, options.RenderOptions.ThreadCount);
+    }
+    catch (Exception exception) when (exception is IOException or SocketException or InvalidDataException)
+    {
+        Console.Error.WriteLine($"Worker stopped: {exception.Message}");
+        return 1;
+    }
+
+    return 0;
+}
+
+if (!options.IsJsonOutput)
+{
+    Console.ForegroundColor = ConsoleColor.White;
+    Console.WriteLine("Ray Trace Console");
+}
+
+var camera = new Camera();
+var scene = options.ScenePath switch
+{
+    null => CreateDefaultScene(),
+    var scenePath when Path.GetExtension(scenePath).Equals(SceneFile.Extension, StringComparison.OrdinalIgnoreCase) => SceneFile.Read(scenePath, out camera),
+    var scenePath => SceneFileReader.Read(scenePath, out camera)
+};
 
-var aspectRatio = 16.0f / 9.0f;
-var outputWidth = 800;
-var outputHeight = (int)(outputWidth / aspectRatio);
-var outputPath = "./TestData/OutputConsole.png";
+// NOTE: Builds the acceleration structures once instead of in every render pass
+scene.CommitChanges();
 
-var camera = new Camera
+if (options.ExportScenePath is not null)
 {
-    AspectRatio = aspectRatio
+    SceneFile.Write(options.ExportScenePath, scene, camera, scene.AccelerationStructure);
+    Console.WriteLine($"Scene exported to {options.ExportScenePath}");
+    Console.ResetColor();
+    return 0;
+}
+
+camera = camera with
+{
+    AspectRatio = (float)options.Width / options.Height
 };
 
+var bandHeight = options.BandHeight > 0 ? Math.Min(options.BandHeight, options.Height) : options.Height;
+
 var outputImage = new FileImage
 {
-    Width = outputWidth,
-    Height = outputHeight,
-    ImageData = new Vector4[outputWidth * outputHeight]
+    Width = options.Width,
+    Height = options.Height,
+    AccumulationBuffer = new AccumulationBuffer(options.Width, bandHeight, null, options.RenderOptions.IsDenoiserEnabled),
+    ToneMappingOperator = options.RenderOptions.ToneMappingOperator,
+    OutputFormat = options.OutputFormat
 };
 
 var imageWriter = new FileImageWriter();
 var renderer = new Renderer<FileImage, string>(imageWriter, new RandomGenerator());
 
-var scene = new Scene();
+using var renderMetrics = new RenderMetrics();
+renderMetrics.Add("console", renderer.Counters);
 
-scene.Materials.Add(new Material()
-{
-    Albedo = new Vector3(1.0f, 1.0f, 0.0f),
-    Roughness = 0.0f
-});
+// Rendering
+var stopwatch = new Stopwatch();
+stopwatch.Start();
+
+var renderStopwatch = new Stopwatch();
+var counters = renderer.Counters;
+var timeBudget = options.TimeBudget > 0.0 ? TimeSpan.FromSeconds(options.TimeBudget) : TimeSpan.MaxValue;
+var passCount = 0;
+var convergedBlockCount = 0;
+var blockCount = 0;
+var workerCount = 0;
+var denoiseTime = TimeSpan.Zero;
+ulong imageHash;
 
-scene.Materials.Add(new Material()
+if (options.IsCoordinator)
 {
-    Albedo = new Vector3(0.0f, 0.2f, 1.0f),
-    Roughness = 0.1f
-});
+    using var coordinator = new RenderCoordinator(new IPEndPoint(options.ListenPort is not null ? IPAddress.Any : IPAddress.Loopback, options.ListenPort ?? 0));
+    renderMetrics.Add("coordinator", coordinator.Counters);
 
-scene.Spheres.Add(new Sphere()
+    var localWorkers = StartLocalWorkers(coordinator.Port, options.LocalWorkerCount, options.RenderOptions.ThreadCount);
+
+    try
+    {
+        renderStopwatch.Start();
+        coordinator.Render(RenderJob.Create(options.Width, options.Height, options.SampleCount, options.RenderOptions, scene, camera), outputImage.AccumulationBuffer, TimeSpan.FromSeconds(options.WorkerTimeout));
+        renderStopwatch.Stop();
+    }
+    catch (TimeoutException exception)
+    {
+        Console.Error.WriteLine(exception.Message);
+        return 1;
+    }
+    finally
+    {
+        StopLocalWorkers(localWorkers);
+    }
+
+    renderer.CommitImage(outputImage, options.OutputPath);
+
+    counters = coordinator.Counters;
+    passCount = options.SampleCount;
+    workerCount = coordinator.WorkerCount;
+    convergedBlockCount = outputImage.AccumulationBuffer.ConvergedBlockCount;
+    blockCount = outputImage.AccumulationBuffer.BlockCount;
+    imageHash = outputImage.AccumulationBuffer.ComputeHash();
+}
+else if (options.BandHeight > 0)
 {
-    Position = new Vector3(0.0f, 0.0f, 0.0f),
-    Radius = 1.0f,
-    MaterialIndex = 0 
-});
+    // NOTE: Bands are rendered to completion from the top of the image and streamed to the
+    // output so the memory usage only depends on the band height. The time budget is split
+    // between the bands and the image hash combines the hash of every band.
+    using var fileStream = new FileStream(options.OutputPath, FileMode.Create);
+    using var pngWriter = new PngStreamWriter(fileStream, options.Width, options.Height);
+
+    imageHash = 14695981039346656037;
 
-scene.Spheres.Add(new Sphere()
+    for (var bandEnd = options.Height; bandEnd > 0; bandEnd -= bandHeight)
+    {
+        var region = new Tile { X = 0, Y = Math.Max(bandEnd - bandHeight, 0), Width = options.Width, Height = Math.Min(bandHeight, bandEnd) };
+        var bandImage = region.Height == bandHeight ? outputImage : outputImage with { AccumulationBuffer = new AccumulationBuffer(region.Width, region.Height) };
+
+        bandImage.AccumulationBuffer.Reset();
+        passCount = Math.Max(passCount, RenderPasses(bandImage, options.RenderOptions with { Region = region }, timeBudget == TimeSpan.MaxValue ? timeBudget : timeBudget * region.Height / options.Height));
+        pngWriter.WriteRows(bandImage.AccumulationBuffer, bandImage.ToneMappingOperator);
+
+        convergedBlockCount += bandImage.AccumulationBuffer.ConvergedBlockCount;
+        blockCount += bandImage.AccumulationBuffer.BlockCount;
+        imageHash = (imageHash ^ bandImage.AccumulationBuffer.ComputeHash()) * 1099511628211;
+    }
+}
+else
 {
-    Position = new Vector3(0.0f, -101.0f, 0.0f),
-    Radius = 100.0f,
-    MaterialIndex = 1
-});
+    passCount = RenderPasses(outputImage, options.RenderOptions, timeBudget);
 
-// Rendering
-var stopwatch = new Stopwatch();
-stopwatch.Start();
+    // NOTE: The image hash is the one of the rendered samples, not of the denoised image
+    if (options.RenderOptions.IsDenoiserEnabled)
+    {
+        var denoiseStopwatch = Stopwatch.StartNew();
+        var denoisedImage = outputImage with { AccumulationBuffer = new AccumulationBuffer(options.Width, options.Height) };
+
+        new Denoiser().Denoise(outputImage.AccumulationBuffer, denoisedImage.AccumulationBuffer, options.RenderOptions.ThreadCount, CancellationToken.None);
+        denoiseTime = denoiseStopwatch.Elapsed;
 
-renderer.Render(outputImage, scene, camera);
-renderer.CommitImage(outputImage, outputPath);
+        renderer.CommitImage(denoisedImage, options.OutputPath);
+    }
+    else
+    {
+        renderer.CommitImage(outputImage, options.OutputPath);
+    }
 
+    convergedBlockCount = outputImage.AccumulationBuffer.ConvergedBlockCount;
+    blockCount = outputImage.AccumulationBuffer.BlockCount;
+    imageHash = outputImage.AccumulationBuffer.ComputeHash();
+}
+
+var renderTime = renderStopwatch.Elapsed;
+var counterValues = counters.GetValues();
 stopwatch.Stop();
 
+var report = new RenderReport
+{
+    Width = options.Width,
+    Height = options.Height,
+    SampleCount = options.SampleCount,
+    PassCount = passCount,
+    ConvergedBlockCount = convergedBlockCount,
+    BlockCount = blockCount,
+    ThreadCount = options.RenderOptions.ThreadCount > 0 ? options.RenderOptions.ThreadCount : Environment.ProcessorCount,
+    TotalSeconds = stopwatch.Elapsed.TotalSeconds,
+    RenderSeconds = renderTime.TotalSeconds,
+    WorkerCount = workerCount,
+    SamplesPerSecond = counterValues.SampleCount / renderTime.TotalSeconds,
+    RaysPerSecond = counterValues.RayCount / renderTime.TotalSeconds,
+    RayCount = counterValues.RayCount,
+    ShadowRayCount = counterValues.ShadowRayCount,
+    IntersectionTestCount = counterValues.IntersectionTestCount,
+    BouncesPerPath = counterValues.BouncesPerPath,
+    RussianRouletteRatio = counterValues.RussianRouletteRatio,
+    HitRatio = counterValues.HitRatio,
+    StageSeconds = new Dictionary<string, double>
+    {
+        ["render"] = counterValues.RenderTime.TotalSeconds,
+        ["accumulate"] = counterValues.AccumulateTime.TotalSeconds,
+        ["convergence"] = counterValues.ConvergenceTime.TotalSeconds,
+        ["denoise"] = denoiseTime.TotalSeconds
+    },
+    ImageHash = imageHash.ToString("X16", CultureInfo.InvariantCulture)
+};
+
+if (options.IsJsonOutput)
+{
+    Console.WriteLine(JsonSerializer.Serialize(report, new JsonSerializerOptions(JsonSerializerDefaults.Web)));
+    return 0;
+}
+
 Console.ResetColor();
 Console.WriteLine();
 Console.ForegroundColor = ConsoleColor.Green;
-Console.WriteLine($"Render done in {stopwatch.Elapsed.TotalSeconds}s");
+Console.WriteLine($"Render done in {report.TotalSeconds}s");
+Console.WriteLine($"Passes: {report.PassCount}/{report.SampleCount}, Converged blocks: {report.ConvergedBlockCount}/{report.BlockCount}");
+
+if (report.WorkerCount > 0)
+{
+    Console.WriteLine($"Workers: {report.WorkerCount}");
+}
+
+Console.WriteLine($"Samples/s: {report.SamplesPerSecond:N0}, Rays/s: {report.RaysPerSecond:N0}, Shadow rays: {report.ShadowRayCount:N0}");
+Console.WriteLine($"Path length: {report.BouncesPerPath:N2}, Roulette: {report.RussianRouletteRatio:P1}, Hit ratio: {report.HitRatio:P1}, Intersection tests/ray: {(double)report.IntersectionTestCount / (report.RayCount + report.ShadowRayCount):N1}");
+Console.WriteLine($"Stage time: {string.Join(", ", report.StageSeconds.Select(item => $"{item.Key}={item.Value:N2}s"))}");
+Console.WriteLine($"Image hash: {report.ImageHash}");
 Console.ResetColor();
+
+return 0;
+
+// NOTE: Rendering stops early when every block converged or when the time budget is spent,
+// the pass in flight is always completed so every active pixel has the same sample count
+int RenderPasses(FileImage image, RenderOptions renderOptions, TimeSpan timeBudget)
+{
+    var passStopwatch = Stopwatch.StartNew();
+    var renderedPassCount = 0;
+
+    renderStopwatch.Start();
+
+    while (renderedPassCount < options.SampleCount && !image.AccumulationBuffer.IsConverged && passStopwatch.Elapsed < timeBudget)
+    {
+        renderer.Render(image, scene, camera, renderOptions, CancellationToken.None);
+        renderedPassCount++;
+    }
+
+    renderStopwatch.Stop();
+    return renderedPassCount;
+}
+
+// NOTE: Local workers share the logical processors when no thread count is given
+static Process[] StartLocalWorkers(int port, int workerCount, int threadCount)
+{
+    var processPath = Environment.ProcessPath ?? throw new InvalidOperationException("Cannot find the path of the current process.");
+    var workers = new Process[workerCount];
+
+    for (var i = 0; i < workerCount; i++)
+    {
+        var startInfo = new ProcessStartInfo(processPath) { UseShellExecute = false };
+
+        // When started with the dotnet host the assembly must be passed first
+        if (Path.GetFileNameWithoutExtension(processPath).Equals("dotnet", StringComparison.OrdinalIgnoreCase))
+        {
+            startInfo.ArgumentList.Add(typeof(RenderWorker).Assembly.Location);
+        }
+
+        startInfo.ArgumentList.Add("--worker");
+        startInfo.ArgumentList.Add($"127.0.0.1:{port}");
+        startInfo.ArgumentList.Add("--threads");
+        startInfo.ArgumentList.Add((threadCount > 0 ? threadCount : Math.Max(Environment.ProcessorCount / workerCount, 1)).ToString(CultureInfo.InvariantCulture));
+
+        workers[i] = Process.Start(startInfo) ?? throw new InvalidOperationException("Cannot start a local worker.");
+    }
+
+    return workers;
+}
+
+static void StopLocalWorkers(Process[] workers)
+{
+    foreach (var worker in workers)
+    {
+        if (!worker.WaitForExit(TimeSpan.FromSeconds(5)))
+        {
+            worker.Kill();
+        }
+
+        worker.Dispose();
+    }
+}
+
+static Scene CreateDefaultScene()
+{
+    var scene = new Scene();
+
+    scene.Materials.Add(new Material()
+    {
+        Albedo = new Vector3(1.0f, 1.0f, 0.0f),
+        Roughness = 0.0f,
+        Metallic = 1.0f
+    });
+
+    scene.Materials.Add(new Material()
+    {
+        Albedo = new Vector3(0.0f, 0.2f, 1.0f),
+        Roughness = 0.1f
+    });
+
+    scene.Spheres.Add(new Sphere()
+    {
+        Position = new Vector3(0.0f, 0.0f, 0.0f),
+        Radius = 1.0f,
+        MaterialIndex = 0 
+    });
+
+    scene.Spheres.Add(new Sphere()
+    {
+        Position = new Vector3(0.0f, -101.0f, 0.0f),
+        Radius = 100.0f,
+        MaterialIndex = 1
+    });
+
+    scene.Lights.Add(new Light()
+    {
+        Direction = new Vector3(1.0f, -1.0f, 1.0f),
+        Intensity = 3.0f
+    });
+
+    return scene;
+}
@@ -0,0 +1,128 @@
+using System.Diagnostics;
+
+namespace PathTracer.Console;
+
+// NOTE: Hands out the regions of a frame to the workers. Once every region was handed out,
+// idle workers render a backup copy of a region that is still in flight so a slow worker
+// cannot hold the whole frame, the first result wins. Regions of lost workers go back to
+// the queue. Renders are deterministic so every copy of a region has the same result.
+public sealed class RegionQueue
+{
+    private const int MaxOwnerCount = 2;
+
+    private readonly object _lock = new();
+    private readonly Queue<int> _pendingRegions;
+    private readonly int[] _ownerCounts;
+    private readonly bool[] _isCompleted;
+    private int _completedCount;
+
+    public RegionQueue(int regionCount)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(regionCount);
+
+        _pendingRegions = new Queue<int>(Enumerable.Range(0, regionCount));
+        _ownerCounts = new int[regionCount];
+        _isCompleted = new bool[regionCount];
+    }
+
+    public int RegionCount => _isCompleted.Length;
+    public int CompletedCount => Volatile.Read(ref _completedCount);
+
+    // NOTE: Blocks until a region is available, returns false once every region is completed
+    public bool TryTake(out int regionIndex)
+    {
+        lock (_lock)
+        {
+            while (_completedCount < _isCompleted.Length)
+            {
+                while (_pendingRegions.TryDequeue(out regionIndex))
+                {
+                    if (!_isCompleted[regionIndex])
+                    {
+                        _ownerCounts[regionIndex]++;
+                        return true;
+                    }
+                }
+
+                for (regionIndex = 0; regionIndex < _isCompleted.Length; regionIndex++)
+                {
+                    if (!_isCompleted[regionIndex] && _ownerCounts[regionIndex] > 0 && _ownerCounts[regionIndex] < MaxOwnerCount)
+                    {
+                        _ownerCounts[regionIndex]++;
+                        return true;
+                    }
+                }
+
+                Monitor.Wait(_lock);
+            }
+
+            regionIndex = -1;
+            return false;
+        }
+    }
+
+    // NOTE: Returns false when another worker already completed the region
+    public bool Complete(int regionIndex)
+    {
+        lock (_lock)
+        {
+            _ownerCounts[regionIndex]--;
+
+            if (_isCompleted[regionIndex])
+            {
+                return false;
+            }
+
+            _isCompleted[regionIndex] = true;
+            _completedCount++;
+
+            Monitor.PulseAll(_lock);
+            return true;
+        }
+    }
+
+    public void Release(int regionIndex)
+    {
+        lock (_lock)
+        {
+            _ownerCounts[regionIndex]--;
+
+            if (!_isCompleted[regionIndex] && _ownerCounts[regionIndex] == 0)
+            {
+                _pendingRegions.Enqueue(regionIndex);
+            }
+
+            Monitor.PulseAll(_lock);
+        }
+    }
+
+    // NOTE: Returns false when no region was completed during the timeout
+    public bool WaitForCompletion(TimeSpan timeout)
+    {
+        lock (_lock)
+        {
+            var completedCount = _completedCount;
+            var stopwatch = Stopwatch.StartNew();
+
+            while (_completedCount < _isCompleted.Length)
+            {
+                var remainingTime = timeout - stopwatch.Elapsed;
+
+                if (remainingTime <= TimeSpan.Zero)
+                {
+                    return false;
+                }
+
+                Monitor.Wait(_lock, remainingTime);
+
+                if (_completedCount != completedCount)
+                {
+                    completedCount = _completedCount;
+                    stopwatch.Restart();
+                }
+            }
+
+            return true;
+        }
+    }
+}
\ No newline at end of file
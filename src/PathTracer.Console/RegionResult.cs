@@ -0,0 +1,14 @@
+namespace PathTracer.Console;
+
+public readonly record struct RegionResult
+{
+    public RegionResult()
+    {
+        Samples = [];
+    }
+
+    public int RegionIndex { get; init; }
+    public int FrameCount { get; init; }
+    public RenderCounterValues Counters { get; init; }
+    public Vector4[] Samples { get; init; }
+}
\ No newline at end of file
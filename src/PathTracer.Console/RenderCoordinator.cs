@@ -0,0 +1,184 @@
+using System.Net;
+using System.Net.Sockets;
+
+namespace PathTracer.Console;
+
+// NOTE: Splits a frame in bands of rows that are rendered by worker processes. Workers can
+// connect at any time during the render and pull the next band when they are done, so fast
+// workers render more bands. Each band is rendered with every sample by one worker and sent
+// back as the sums of its samples, the result is identical to a render in one process.
+public sealed class RenderCoordinator : IDisposable
+{
+    public const int RegionHeight = 32;
+
+    private readonly TcpListener _listener;
+    private int _workerCount;
+    private int _activeWorkerCount;
+
+    public RenderCoordinator(IPEndPoint endPoint)
+    {
+        ArgumentNullException.ThrowIfNull(endPoint);
+
+        _listener = new TcpListener(endPoint);
+        _listener.Start();
+
+        Counters = new RenderCounters();
+    }
+
+    public int Port => ((IPEndPoint)_listener.LocalEndpoint).Port;
+    public int WorkerCount => _workerCount;
+    public RenderCounters Counters { get; }
+
+    // NOTE: Workers that send nothing within the timeout are dropped and their band is
+    // rendered by another worker, workers send their progress after every sample so a long
+    // band doesn't time out. The render fails when no band is completed during the timeout
+    // while no worker is connected.
+    public void Render(RenderJob job, AccumulationBuffer accumulationBuffer, TimeSpan workerTimeout)
+    {
+        ArgumentNullException.ThrowIfNull(accumulationBuffer);
+
+        if (accumulationBuffer.Width != job.Width || accumulationBuffer.Height != job.Height)
+        {
+            throw new ArgumentOutOfRangeException(nameof(accumulationBuffer), "Accumulation buffer must have the same size as the image.");
+        }
+
+        var regions = CreateRegions(job.Width, job.Height);
+        var regionQueue = new RegionQueue(regions.Length);
+
+        accumulationBuffer.Reset();
+
+        var acceptTask = Task.Run(() =>
+        {
+            while (true)
+            {
+                TcpClient client;
+
+                try
+                {
+                    client = _listener.AcceptTcpClient();
+                }
+                catch (SocketException)
+                {
+                    // The listener was stopped
+                    break;
+                }
+
+                Task.Factory.StartNew(() => RunWorker(client, job, regions, regionQueue, accumulationBuffer, workerTimeout), TaskCreationOptions.LongRunning);
+            }
+        });
+
+        while (!regionQueue.WaitForCompletion(workerTimeout))
+        {
+            if (Volatile.Read(ref _activeWorkerCount) == 0)
+            {
+                _listener.Stop();
+                throw new TimeoutException($"No worker rendered a region in {workerTimeout.TotalSeconds}s, {regionQueue.CompletedCount}/{regionQueue.RegionCount} regions were completed.");
+            }
+        }
+
+        _listener.Stop();
+        acceptTask.Wait();
+    }
+
+    public void Dispose()
+    {
+        _listener.Dispose();
+    }
+
+    private void RunWorker(TcpClient client, RenderJob job, Tile[] regions, RegionQueue regionQueue, AccumulationBuffer accumulationBuffer, TimeSpan workerTimeout)
+    {
+        var regionIndex = -1;
+        var remoteEndPoint = client.Client.RemoteEndPoint;
+
+        Interlocked.Increment(ref _activeWorkerCount);
+
+        try
+        {
+            using (client)
+            {
+                client.NoDelay = true;
+                client.ReceiveTimeout = (int)workerTimeout.TotalMilliseconds;
+                client.SendTimeout = (int)workerTimeout.TotalMilliseconds;
+
+                using var stream = client.GetStream();
+                using var reader = new BinaryReader(stream);
+                using var writer = new BinaryWriter(new BufferedStream(stream));
+
+                DistributedProtocol.ReadHello(reader);
+                Interlocked.Increment(ref _workerCount);
+
+                DistributedProtocol.WriteJob(writer, job);
+
+                while (regionQueue.TryTake(out regionIndex))
+                {
+                    DistributedProtocol.WriteRenderRegion(writer, regionIndex, regions[regionIndex]);
+                    writer.Flush();
+
+                    MessageType messageType;
+
+                    while ((messageType = DistributedProtocol.ReadMessageType(reader)) == MessageType.Progress)
+                    {
+                        var (progressRegionIndex, _) = DistributedProtocol.ReadProgress(reader);
+
+                        if (progressRegionIndex != regionIndex)
+                        {
+                            throw new InvalidDataException($"Worker sent the progress of region {progressRegionIndex} while rendering region {regionIndex}.");
+                        }
+                    }
+
+                    if (messageType != MessageType.RegionResult)
+                    {
+                        throw new InvalidDataException($"Expected a {MessageType.Progress} or {MessageType.RegionResult} message but received a {messageType} message.");
+                    }
+
+                    var result = DistributedProtocol.ReadRegionResult(reader);
+
+                    if (result.RegionIndex != regionIndex || result.FrameCount != job.SampleCount || result.Samples.Length != regions[regionIndex].PixelCount)
+                    {
+                        throw new InvalidDataException($"Worker sent an invalid result for region {regionIndex}.");
+                    }
+
+                    // Only the first result of a region is merged, backup copies are dropped
+                    lock (accumulationBuffer)
+                    {
+                        if (regionQueue.Complete(regionIndex))
+                        {
+                            accumulationBuffer.CopyRegion(regions[regionIndex], result.FrameCount, result.Samples);
+                            Counters.Add(result.Counters);
+                        }
+                    }
+
+                    regionIndex = -1;
+                }
+
+                DistributedProtocol.WriteDone(writer);
+                writer.Flush();
+            }
+        }
+        catch (Exception exception) when (exception is IOException or SocketException or InvalidDataException)
+        {
+            System.Console.Error.WriteLine($"Worker {remoteEndPoint} lost: {exception.Message}");
+
+            if (regionIndex >= 0)
+            {
+                regionQueue.Release(regionIndex);
+            }
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _activeWorkerCount);
+        }
+    }
+
+    private static Tile[] CreateRegions(int width, int height)
+    {
+        var regions = new Tile[(height + RegionHeight - 1) / RegionHeight];
+
+        for (var i = 0; i < regions.Length; i++)
+        {
+            regions[i] = new Tile { X = 0, Y = i * RegionHeight, Width = width, Height = Math.Min(RegionHeight, height - i * RegionHeight) };
+        }
+
+        return regions;
+    }
+}
\ No newline at end of file
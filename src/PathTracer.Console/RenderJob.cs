@@ -0,0 +1,35 @@
+namespace PathTracer.Console;
+
+// NOTE: Everything a worker needs to render regions of a frame. The scene and the camera are
+// stored in the binary scene format so workers don't rebuild the acceleration structure.
+public readonly record struct RenderJob
+{
+    public RenderJob()
+    {
+        SceneData = ReadOnlyMemory<byte>.Empty;
+        RenderOptions = new RenderOptions();
+    }
+
+    public int Width { get; init; }
+    public int Height { get; init; }
+    public int SampleCount { get; init; }
+    public RenderOptions RenderOptions { get; init; }
+    public ReadOnlyMemory<byte> SceneData { get; init; }
+
+    public static RenderJob Create(int width, int height, int sampleCount, RenderOptions renderOptions, Scene scene, Camera camera)
+    {
+        ArgumentNullException.ThrowIfNull(scene);
+
+        using var stream = new MemoryStream();
+        SceneFile.Write(stream, scene, camera, scene.AccelerationStructure ?? BoundingVolumeHierarchy.Build(scene.Spheres));
+
+        return new RenderJob
+        {
+            Width = width,
+            Height = height,
+            SampleCount = sampleCount,
+            RenderOptions = renderOptions,
+            SceneData = stream.ToArray()
+        };
+    }
+}
\ No newline at end of file
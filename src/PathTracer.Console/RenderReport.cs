@@ -0,0 +1,31 @@
+namespace PathTracer.Console;
+
+public readonly record struct RenderReport
+{
+    public RenderReport()
+    {
+        ImageHash = string.Empty;
+        StageSeconds = new Dictionary<string, double>();
+    }
+
+    public int Width { get; init; }
+    public int Height { get; init; }
+    public int SampleCount { get; init; }
+    public int PassCount { get; init; }
+    public int ConvergedBlockCount { get; init; }
+    public int BlockCount { get; init; }
+    public int ThreadCount { get; init; }
+    public int WorkerCount { get; init; }
+    public double TotalSeconds { get; init; }
+    public double RenderSeconds { get; init; }
+    public double SamplesPerSecond { get; init; }
+    public double RaysPerSecond { get; init; }
+    public long RayCount { get; init; }
+    public long ShadowRayCount { get; init; }
+    public long IntersectionTestCount { get; init; }
+    public double BouncesPerPath { get; init; }
+    public double RussianRouletteRatio { get; init; }
+    public double HitRatio { get; init; }
+    public IReadOnlyDictionary<string, double> StageSeconds { get; init; }
+    public string ImageHash { get; init; }
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+using System.Diagnostics;
+using System.Net.Sockets;
+
+namespace PathTracer.Console;
+
+// NOTE: Worker side of the distributed render. The worker connects to the coordinator,
+// receives the job and renders every region it is given with all the samples before
+// sending back the sums of the samples. The progress is sent after every sample so the
+// coordinator knows the worker is still alive during long regions.
+public static class RenderWorker
+{
+    private static readonly TimeSpan _connectionTimeout = TimeSpan.FromSeconds(10);
+
+    public static void Run(string host, int port, int threadCount)
+    {
+        ArgumentNullException.ThrowIfNull(host);
+
+        using var client = Connect(host, port);
+        client.NoDelay = true;
+
+        using var stream = client.GetStream();
+        using var reader = new BinaryReader(stream);
+        using var writer = new BinaryWriter(new BufferedStream(stream));
+
+        DistributedProtocol.WriteHello(writer);
+        writer.Flush();
+
+        var job = DistributedProtocol.ReadJob(reader);
+        var scene = SceneFile.Read(job.SceneData.Span, out var camera);
+        scene.CommitChanges();
+
+        var renderOptions = job.RenderOptions with { ThreadCount = threadCount };
+        var renderer = new Renderer<FileImage, string>(new FileImageWriter(), new RandomGenerator());
+
+        using var renderMetrics = new RenderMetrics();
+        renderMetrics.Add("worker", renderer.Counters);
+
+        var image = new FileImage
+        {
+            Width = job.Width,
+            Height = job.Height
+        };
+
+        MessageType messageType;
+
+        while ((messageType = DistributedProtocol.ReadMessageType(reader)) == MessageType.RenderRegion)
+        {
+            var (regionIndex, region) = DistributedProtocol.ReadRenderRegion(reader);
+
+            // Regions have the same size except the last one so the buffer is rarely allocated
+            if (image.AccumulationBuffer.Width != region.Width || image.AccumulationBuffer.Height != region.Height)
+            {
+                image = image with { AccumulationBuffer = new AccumulationBuffer(region.Width, region.Height) };
+            }
+
+            var counters = renderer.Counters.GetValues();
+
+            image.AccumulationBuffer.Reset();
+
+            for (var i = 0; i < job.SampleCount; i++)
+            {
+                renderer.Render(image, scene, camera, renderOptions with { Region = region }, CancellationToken.None);
+
+                DistributedProtocol.WriteProgress(writer, regionIndex, i + 1);
+                writer.Flush();
+            }
+
+            DistributedProtocol.WriteRegionResult(writer, regionIndex, image.AccumulationBuffer, renderer.Counters.GetValues().Subtract(counters));
+            writer.Flush();
+        }
+
+        if (messageType != MessageType.Done)
+        {
+            throw new InvalidDataException($"Expected a {MessageType.RenderRegion} or {MessageType.Done} message but received a {messageType} message.");
+        }
+    }
+
+    // NOTE: Local workers can be started before the coordinator listens, so connection
+    // attempts are retried for a few seconds
+    private static TcpClient Connect(string host, int port)
+    {
+        var stopwatch = Stopwatch.StartNew();
+
+        while (true)
+        {
+            var client = new TcpClient();
+
+            try
+            {
+                client.Connect(host, port);
+                return client;
+            }
+            catch (SocketException) when (stopwatch.Elapsed < _connectionTimeout)
+            {
+                client.Dispose();
+                Thread.Sleep(100);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+using System.Globalization;
+
+namespace PathTracer.Console;
+
+// NOTE: Text scene format, one entry per line, values are separated by white spaces and lines
+// starting with # are comments. Sphere material indices refer to the order of the materials.
+//
+// camera <position x y z> <target x y z> <vertical fov>
+// material <albedo r g b> <roughness> <metallic> [<emission r g b>]
+// sphere <position x y z> <radius> <material index>
+// geometry
+// end
+// instance <geometry index> <position x y z> <rotation yaw pitch roll> <scale> <material index>
+// light directional <direction x y z> <color r g b> <intensity>
+// light point <position x y z> <color r g b> <intensity> <radius>
+//
+// Spheres that follow a geometry entry belong to that geometry block until the next end
+// entry, their positions are in the space of the block. Instance rotations are in degrees
+// and a material index of -1 keeps the materials of the block spheres.
+public static class SceneFileReader
+{
+    public static Scene Read(string path, out Camera camera)
+    {
+        ArgumentNullException.ThrowIfNull(path);
+
+        var scene = new Scene();
+        var lines = File.ReadAllLines(path);
+        GeometryBlock? geometry = null;
+
+        camera = new Camera();
+
+        for (var i = 0; i < lines.Length; i++)
+        {
+            var values = lines[i].Split((char[]?)null, StringSplitOptions.RemoveEmptyEntries);
+
+            if (values.Length == 0 || values[0].StartsWith('#'))
+            {
+                continue;
+            }
+
+            var lineNumber = i + 1;
+
+            switch (values[0])
+            {
+                case "camera":
+                    CheckValueCount(values, 8, lineNumber);
+
+                    camera = camera with
+                    {
+                        Position = ReadVector3(values, 1, lineNumber),
+                        Target = ReadVector3(values, 4, lineNumber),
+                        VerticalFov = ReadFloat(values, 7, lineNumber)
+                    };
+                    break;
+
+                case "material":
+                    CheckValueCount(values, values.Length > 6 ? 9 : 6, lineNumber);
+
+                    scene.Materials.Add(new Material
+                    {
+                        Albedo = ReadVector3(values, 1, lineNumber),
+                        Roughness = ReadFloat(values, 4, lineNumber),
+                        Metallic = ReadFloat(values, 5, lineNumber),
+                        Emission = values.Length > 6 ? ReadVector3(values, 6, lineNumber) : Vector3.Zero
+                    });
+                    break;
+
+                case "sphere":
+                    CheckValueCount(values, 6, lineNumber);
+
+                    (geometry?.Spheres ?? scene.Spheres).Add(new Sphere
+                    {
+                        Position = ReadVector3(values, 1, lineNumber),
+                        Radius = ReadFloat(values, 4, lineNumber),
+                        MaterialIndex = ReadInt(values, 5, lineNumber)
+                    });
+                    break;
+
+                case "geometry":
+                    CheckValueCount(values, 1, lineNumber);
+
+                    geometry = new GeometryBlock();
+                    scene.Geometries.Add(geometry);
+                    break;
+
+                case "end":
+                    CheckValueCount(values, 1, lineNumber);
+
+                    if (geometry is null)
+                    {
+                        throw new InvalidDataException($"Line {lineNumber}: 'end' without a geometry.");
+                    }
+
+                    geometry = null;
+                    break;
+
+                case "instance":
+                    CheckValueCount(values, 10, lineNumber);
+
+                    var rotation = ReadVector3(values, 5, lineNumber) * (MathF.PI / 180.0f);
+
+                    scene.Instances.Add(new Instance
+                    {
+                        GeometryIndex = ReadInt(values, 1, lineNumber),
+                        Position = ReadVector3(values, 2, lineNumber),
+                        Rotation = Quaternion.CreateFromYawPitchRoll(rotation.X, rotation.Y, rotation.Z),
+                        Scale = ReadFloat(values, 8, lineNumber),
+                        MaterialIndex = ReadInt(values, 9, lineNumber)
+                    });
+                    break;
+
+                case "light":
+                    scene.Lights.Add(ReadLight(values, lineNumber));
+                    break;
+
+                default:
+                    throw new InvalidDataException($"Line {lineNumber}: unknown entry '{values[0]}'.");
+            }
+        }
+
+        if (geometry is not null)
+        {
+            throw new InvalidDataException("Geometry is missing its 'end' entry.");
+        }
+
+        foreach (var sphere in scene.Spheres.Concat(scene.Geometries.SelectMany(block => block.Spheres)))
+        {
+            if (sphere.MaterialIndex < 0 || sphere.MaterialIndex >= scene.Materials.Count)
+            {
+                throw new InvalidDataException($"Sphere material index {sphere.MaterialIndex} is outside the {scene.Materials.Count} materials of the scene.");
+            }
+        }
+
+        foreach (var instance in scene.Instances)
+        {
+            if (instance.GeometryIndex < 0 || instance.GeometryIndex >= scene.Geometries.Count)
+            {
+                throw new InvalidDataException($"Instance geometry index {instance.GeometryIndex} is outside the {scene.Geometries.Count} geometries of the scene.");
+            }
+
+            if (instance.MaterialIndex < -1 || instance.MaterialIndex >= scene.Materials.Count)
+            {
+                throw new InvalidDataException($"Instance material index {instance.MaterialIndex} is outside the {scene.Materials.Count} materials of the scene.");
+            }
+
+            if (!(instance.Scale > 0.0f))
+            {
+                throw new InvalidDataException($"Instance scale {instance.Scale} must be positive.");
+            }
+        }
+
+        return scene;
+    }
+
+    private static Light ReadLight(string[] values, int lineNumber)
+    {
+        var lightType = values.Length > 1 ? values[1] : string.Empty;
+
+        switch (lightType)
+        {
+            case "directional":
+                CheckValueCount(values, 9, lineNumber);
+
+                var direction = ReadVector3(values, 2, lineNumber);
+
+                if (direction.LengthSquared() == 0.0f)
+                {
+                    throw new InvalidDataException($"Line {lineNumber}: light direction cannot be zero.");
+                }
+
+                return new Light
+                {
+                    Type = LightType.Directional,
+                    Direction = direction,
+                    Color = ReadVector3(values, 5, lineNumber),
+                    Intensity = ReadFloat(values, 8, lineNumber)
+                };
+
+            case "point":
+                CheckValueCount(values, 10, lineNumber);
+
+                var radius = ReadFloat(values, 9, lineNumber);
+
+                if (radius < 0.0f)
+                {
+                    throw new InvalidDataException($"Line {lineNumber}: light radius {radius} cannot be negative.");
+                }
+
+                return new Light
+                {
+                    Type = LightType.Point,
+                    Position = ReadVector3(values, 2, lineNumber),
+                    Color = ReadVector3(values, 5, lineNumber),
+                    Intensity = ReadFloat(values, 8, lineNumber),
+                    Radius = radius
+                };
+
+            default:
+                throw new InvalidDataException($"Line {lineNumber}: unknown light type '{lightType}'.");
+        }
+    }
+
+    private static void CheckValueCount(string[] values, int expectedCount, int lineNumber)
+    {
+        if (values.Length != expectedCount)
+        {
+            throw new InvalidDataException($"Line {lineNumber}: '{values[0]}' expects {expectedCount - 1} values but has {values.Length - 1}.");
+        }
+    }
+
+    private static Vector3 ReadVector3(string[] values, int index, int lineNumber)
+    {
+        return new Vector3(ReadFloat(values, index, lineNumber), ReadFloat(values, index + 1, lineNumber), ReadFloat(values, index + 2, lineNumber));
+    }
+
+    private static float ReadFloat(string[] values, int index, int lineNumber)
+    {
+        if (!float.TryParse(values[index], NumberStyles.Float, CultureInfo.InvariantCulture, out var value))
+        {
+            throw new InvalidDataException($"Line {lineNumber}: '{values[index]}' is not a valid number.");
+        }
+
+        return value;
+    }
+
+    private static int ReadInt(string[] values, int index, int lineNumber)
+    {
+        if (!int.TryParse(values[index], NumberStyles.Integer, CultureInfo.InvariantCulture, out var value))
+        {
+            throw new InvalidDataException($"Line {lineNumber}: '{values[index]}' is not a valid integer.");
+        }
+
+        return value;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,423 @@
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Stores the sum of all the HDR samples rendered since the last reset. Rows are stored
+// bottom to top, row Height - 1 is the top of the image, and the average is only computed
+// when the image is resolved.
+// The sum of the squared luminances is stored as well to estimate the noise of every block
+// of pixels. Converged blocks stop receiving samples and are resolved with the sample count
+// they had when they converged. Buffers created with a pool rent their arrays from it and
+// give them back when they are disposed. Buffers with features also accumulate the first
+// hit features of every sample for the denoiser.
+public sealed class AccumulationBuffer : IDisposable
+{
+    public const int ConvergenceBlockSize = 8;
+
+    // NOTE: The variance estimate is not reliable with fewer samples
+    public const int MinimumConvergenceSampleCount = 8;
+
+    // NOTE: Dark pixels are compared to this luminance so their relative error doesn't explode
+    private const float MinimumErrorLuminance = 0.05f;
+
+    private static readonly Vector3 _luminanceWeights = new Vector3(0.2126f, 0.7152f, 0.0722f);
+
+    private readonly RenderBufferPool? _bufferPool;
+    private readonly int _blockCountX;
+    private readonly int _blockCountY;
+    private Vector4[] _samples;
+    private float[] _squaredLuminances;
+    private int[] _convergedSampleCounts;
+    private PixelFeatures[] _features;
+    private int _frameCount;
+    private int _convergedBlockCount;
+
+    public AccumulationBuffer(int width, int height) : this(width, height, null)
+    {
+    }
+
+    public AccumulationBuffer(int width, int height, RenderBufferPool? bufferPool) : this(width, height, bufferPool, false)
+    {
+    }
+
+    public AccumulationBuffer(int width, int height, RenderBufferPool? bufferPool, bool hasFeatures)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(width);
+        ArgumentOutOfRangeException.ThrowIfNegative(height);
+
+        Width = width;
+        Height = height;
+        HasFeatures = hasFeatures;
+
+        _bufferPool = bufferPool;
+        _blockCountX = (width + ConvergenceBlockSize - 1) / ConvergenceBlockSize;
+        _blockCountY = (height + ConvergenceBlockSize - 1) / ConvergenceBlockSize;
+
+        // NOTE: Rented arrays can be longer than the buffer and are not cleared, the samples
+        // are overwritten by the first frame but the converged blocks must start cleared
+        if (bufferPool is not null)
+        {
+            _samples = bufferPool.Rent<Vector4>(width * height);
+            _squaredLuminances = bufferPool.Rent<float>(width * height);
+            _convergedSampleCounts = bufferPool.Rent<int>(_blockCountX * _blockCountY);
+            _convergedSampleCounts.AsSpan(0, BlockCount).Clear();
+            _features = hasFeatures ? bufferPool.Rent<PixelFeatures>(width * height) : [];
+        }
+        else
+        {
+            _samples = new Vector4[width * height];
+            _squaredLuminances = new float[width * height];
+            _convergedSampleCounts = new int[_blockCountX * _blockCountY];
+            _features = hasFeatures ? new PixelFeatures[width * height] : [];
+        }
+    }
+
+    public int Width { get; }
+    public int Height { get; }
+    public int FrameCount => _frameCount;
+    public int BlockCount => _blockCountX * _blockCountY;
+    public int ConvergedBlockCount => _convergedBlockCount;
+    public bool IsConverged => _convergedBlockCount == BlockCount;
+    public bool HasFeatures { get; }
+
+    // NOTE: Sums of the samples, used to send a rendered region to another process
+    public ReadOnlySpan<Vector4> Samples => _samples.AsSpan(0, Width * Height);
+
+    // NOTE: The buffer is not cleared, the first frame after a reset overwrites the samples
+    public void Reset()
+    {
+        Interlocked.Exchange(ref _frameCount, 0);
+
+        if (_convergedBlockCount > 0)
+        {
+            _convergedSampleCounts.AsSpan(0, BlockCount).Clear();
+            _convergedBlockCount = 0;
+        }
+    }
+
+    // NOTE: The buffer cannot be used once its arrays went back to the pool, renders that
+    // use it must be completed first
+    public void Dispose()
+    {
+        if (_bufferPool is null)
+        {
+            return;
+        }
+
+        _bufferPool.Return(Interlocked.Exchange(ref _samples, []));
+        _bufferPool.Return(Interlocked.Exchange(ref _squaredLuminances, []));
+        _bufferPool.Return(Interlocked.Exchange(ref _convergedSampleCounts, []));
+        _bufferPool.Return(Interlocked.Exchange(ref _features, []));
+    }
+
+    public int BeginFrame()
+    {
+        return Interlocked.Increment(ref _frameCount);
+    }
+
+    public bool IsPixelConverged(int x, int y)
+    {
+        return _convergedBlockCount > 0 && _convergedSampleCounts[y / ConvergenceBlockSize * _blockCountX + x / ConvergenceBlockSize] > 0;
+    }
+
+    public bool IsTileConverged(Tile tile)
+    {
+        if (_convergedBlockCount == 0)
+        {
+            return false;
+        }
+
+        for (var i = tile.Y / ConvergenceBlockSize; i <= (tile.Y + tile.Height - 1) / ConvergenceBlockSize; i++)
+        {
+            for (var j = tile.X / ConvergenceBlockSize; j <= (tile.X + tile.Width - 1) / ConvergenceBlockSize; j++)
+            {
+                if (_convergedSampleCounts[i * _blockCountX + j] == 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // NOTE: Samples of converged pixels are ignored
+    public void AccumulateTile(Tile tile, int frameIndex, ReadOnlySpan<Vector4> tileSamples)
+    {
+        AccumulateTile(tile, frameIndex, tileSamples, []);
+    }
+
+    // NOTE: Features are only accumulated when the buffer has features, they can be empty otherwise
+    public void AccumulateTile(Tile tile, int frameIndex, ReadOnlySpan<Vector4> tileSamples, ReadOnlySpan<PixelFeatures> tileFeatures)
+    {
+        if (HasFeatures)
+        {
+            ArgumentOutOfRangeException.ThrowIfLessThan(tileFeatures.Length, tile.PixelCount, nameof(tileFeatures));
+        }
+
+        if (tile.X < 0 || tile.Y < 0 || tile.X + tile.Width > Width || tile.Y + tile.Height > Height)
+        {
+            throw new ArgumentOutOfRangeException(nameof(tile), "Tile must be inside the accumulation buffer.");
+        }
+
+        for (var i = 0; i < tile.Height; i++)
+        {
+            var y = tile.Y + i;
+
+            for (var x = tile.X; x < tile.X + tile.Width;)
+            {
+                var segmentWidth = GetSegmentWidth(x, tile.X + tile.Width);
+
+                if (!IsPixelConverged(x, y))
+                {
+                    var source = tileSamples.Slice(i * tile.Width + x - tile.X, segmentWidth);
+                    var destination = _samples.AsSpan(y * Width + x, segmentWidth);
+                    var squaredLuminances = _squaredLuminances.AsSpan(y * Width + x, segmentWidth);
+
+                    if (frameIndex == 1)
+                    {
+                        source.CopyTo(destination);
+                        squaredLuminances.Clear();
+                    }
+                    else
+                    {
+                        Add(MemoryMarshal.Cast<Vector4, float>(source), MemoryMarshal.Cast<Vector4, float>(destination));
+                    }
+
+                    AddSquaredLuminances(source, squaredLuminances);
+
+                    if (HasFeatures)
+                    {
+                        var sourceFeatures = MemoryMarshal.Cast<PixelFeatures, float>(tileFeatures.Slice(i * tile.Width + x - tile.X, segmentWidth));
+                        var destinationFeatures = MemoryMarshal.Cast<PixelFeatures, float>(_features.AsSpan(y * Width + x, segmentWidth));
+
+                        if (frameIndex == 1)
+                        {
+                            sourceFeatures.CopyTo(destinationFeatures);
+                        }
+                        else
+                        {
+                            Add(sourceFeatures, destinationFeatures);
+                        }
+                    }
+                }
+
+                x += segmentWidth;
+            }
+        }
+    }
+
+    // NOTE: Copies the sums of a region rendered by another process. Every region must have
+    // been rendered with the same frame count and without adaptive sampling.
+    public void CopyRegion(Tile region, int frameCount, ReadOnlySpan<Vector4> regionSamples)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(frameCount);
+        ArgumentOutOfRangeException.ThrowIfLessThan(regionSamples.Length, region.PixelCount, nameof(regionSamples));
+
+        if (region.X < 0 || region.Y < 0 || region.X + region.Width > Width || region.Y + region.Height > Height)
+        {
+            throw new ArgumentOutOfRangeException(nameof(region), "Region must be inside the accumulation buffer.");
+        }
+
+        if (_frameCount != 0 && _frameCount != frameCount)
+        {
+            throw new InvalidOperationException("Every region must have the same frame count.");
+        }
+
+        _frameCount = frameCount;
+
+        for (var i = 0; i < region.Height; i++)
+        {
+            regionSamples.Slice(i * region.Width, region.Width).CopyTo(_samples.AsSpan((region.Y + i) * Width + region.X, region.Width));
+            _squaredLuminances.AsSpan((region.Y + i) * Width + region.X, region.Width).Clear();
+
+            if (HasFeatures)
+            {
+                _features.AsSpan((region.Y + i) * Width + region.X, region.Width).Clear();
+            }
+        }
+    }
+
+    // NOTE: Marks the blocks whose relative standard error of the mean luminance is below the
+    // threshold as converged. Returns the number of blocks that still need samples.
+    public int UpdateConvergence(float errorThreshold)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(errorThreshold);
+
+        var sampleCount = _frameCount;
+
+        if (sampleCount >= MinimumConvergenceSampleCount)
+        {
+            for (var i = 0; i < _blockCountY; i++)
+            {
+                for (var j = 0; j < _blockCountX; j++)
+                {
+                    var blockIndex = i * _blockCountX + j;
+
+                    if (_convergedSampleCounts[blockIndex] == 0 && ComputeBlockError(j, i, sampleCount) <= errorThreshold)
+                    {
+                        _convergedSampleCounts[blockIndex] = sampleCount;
+                        _convergedBlockCount++;
+                    }
+                }
+            }
+        }
+
+        return BlockCount - _convergedBlockCount;
+    }
+
+    public void ResolveRow(int y, Span<Vector4> destination)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(y);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(y, Height);
+        ArgumentOutOfRangeException.ThrowIfLessThan(destination.Length, Width, nameof(destination));
+
+        for (var x = 0; x < Width;)
+        {
+            var segmentWidth = GetSegmentWidth(x, Width);
+            var source = _samples.AsSpan(y * Width + x, segmentWidth);
+
+            Scale(MemoryMarshal.Cast<Vector4, float>(source), GetResolveScale(x, y), MemoryMarshal.Cast<Vector4, float>(destination.Slice(x, segmentWidth)));
+            x += segmentWidth;
+        }
+    }
+
+    public void ResolveRow(int y, Span<uint> destination, ToneMappingOperator toneMappingOperator)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(y);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(y, Height);
+        ArgumentOutOfRangeException.ThrowIfLessThan(destination.Length, Width, nameof(destination));
+
+        for (var x = 0; x < Width;)
+        {
+            var segmentWidth = GetSegmentWidth(x, Width);
+
+            ToneMapping.ResolveToRgba8(_samples.AsSpan(y * Width + x, segmentWidth), GetResolveScale(x, y), destination.Slice(x, segmentWidth), toneMappingOperator);
+            x += segmentWidth;
+        }
+    }
+
+    // NOTE: Averages of the features, pixels without samples have empty features
+    public void ResolveFeaturesRow(int y, Span<PixelFeatures> destination)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(y);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(y, Height);
+        ArgumentOutOfRangeException.ThrowIfLessThan(destination.Length, Width, nameof(destination));
+
+        if (!HasFeatures)
+        {
+            throw new InvalidOperationException("Accumulation buffer doesn't have features.");
+        }
+
+        for (var x = 0; x < Width;)
+        {
+            var segmentWidth = GetSegmentWidth(x, Width);
+            var source = _features.AsSpan(y * Width + x, segmentWidth);
+
+            Scale(MemoryMarshal.Cast<PixelFeatures, float>(source), GetResolveScale(x, y), MemoryMarshal.Cast<PixelFeatures, float>(destination.Slice(x, segmentWidth)));
+            x += segmentWidth;
+        }
+    }
+
+    public void Resolve(Span<Vector4> destination)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(destination.Length, Width * Height, nameof(destination));
+
+        for (var i = 0; i < Height; i++)
+        {
+            ResolveRow(i, destination.Slice(i * Width, Width));
+        }
+    }
+
+    // NOTE: FNV-1a hash of the accumulated samples and the frame count. Renders are deterministic
+    // so the hash only changes when the image changes, independently of the thread count,
+    // the tile size or the render mode.
+    public ulong ComputeHash()
+    {
+        const ulong prime = 1099511628211;
+
+        var hash = 14695981039346656037;
+
+        foreach (var value in MemoryMarshal.Cast<Vector4, ulong>(Samples))
+        {
+            hash = (hash ^ value) * prime;
+        }
+
+        return (hash ^ (uint)_frameCount) * prime;
+    }
+
+    // NOTE: Rows are processed in one segment until a block converges, then block by block
+    private int GetSegmentWidth(int x, int end)
+    {
+        return _convergedBlockCount == 0 ? end - x : Math.Min(end, (x / ConvergenceBlockSize + 1) * ConvergenceBlockSize) - x;
+    }
+
+    private float GetResolveScale(int x, int y)
+    {
+        var sampleCount = IsPixelConverged(x, y) ? _convergedSampleCounts[y / ConvergenceBlockSize * _blockCountX + x / ConvergenceBlockSize] : _frameCount;
+        return sampleCount > 0 ? 1.0f / sampleCount : 0.0f;
+    }
+
+    private float ComputeBlockError(int blockX, int blockY, int sampleCount)
+    {
+        var inverseSampleCount = 1.0f / sampleCount;
+        var error = 0.0f;
+        var pixelCount = 0;
+
+        for (var y = blockY * ConvergenceBlockSize; y < Math.Min(Height, (blockY + 1) * ConvergenceBlockSize); y++)
+        {
+            for (var x = blockX * ConvergenceBlockSize; x < Math.Min(Width, (blockX + 1) * ConvergenceBlockSize); x++)
+            {
+                var pixelIndex = y * Width + x;
+                var mean = Vector3.Dot(new Vector3(_samples[pixelIndex].X, _samples[pixelIndex].Y, _samples[pixelIndex].Z), _luminanceWeights) * inverseSampleCount;
+                var variance = MathF.Max(_squaredLuminances[pixelIndex] * inverseSampleCount - mean * mean, 0.0f);
+
+                error += MathF.Sqrt(variance * inverseSampleCount) / MathF.Max(mean, MinimumErrorLuminance);
+                pixelCount++;
+            }
+        }
+
+        return error / pixelCount;
+    }
+
+    private static void AddSquaredLuminances(ReadOnlySpan<Vector4> source, Span<float> destination)
+    {
+        for (var i = 0; i < source.Length; i++)
+        {
+            var luminance = Vector3.Dot(new Vector3(source[i].X, source[i].Y, source[i].Z), _luminanceWeights);
+            destination[i] += luminance * luminance;
+        }
+    }
+
+    private static void Add(ReadOnlySpan<float> source, Span<float> destination)
+    {
+        var sourceVectors = MemoryMarshal.Cast<float, Vector<float>>(source);
+        var destinationVectors = MemoryMarshal.Cast<float, Vector<float>>(destination);
+
+        for (var i = 0; i < sourceVectors.Length; i++)
+        {
+            destinationVectors[i] += sourceVectors[i];
+        }
+
+        for (var i = sourceVectors.Length * Vector<float>.Count; i < source.Length; i++)
+        {
+            destination[i] += source[i];
+        }
+    }
+
+    private static void Scale(ReadOnlySpan<float> source, float scale, Span<float> destination)
+    {
+        var sourceVectors = MemoryMarshal.Cast<float, Vector<float>>(source);
+        var destinationVectors = MemoryMarshal.Cast<float, Vector<float>>(destination);
+
+        for (var i = 0; i < sourceVectors.Length; i++)
+        {
+            destinationVectors[i] = sourceVectors[i] * scale;
+        }
+
+        for (var i = sourceVectors.Length * Vector<float>.Count; i < source.Length; i++)
+        {
+            destination[i] = source[i] * scale;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+namespace PathTracer.Core;
+
+public readonly record struct BoundingBox
+{
+    public BoundingBox()
+    {
+        Min = new Vector3(float.MaxValue);
+        Max = new Vector3(float.MinValue);
+    }
+
+    public Vector3 Min { get; init; }
+    public Vector3 Max { get; init; }
+
+    public Vector3 Center => (Min + Max) * 0.5f;
+    public Vector3 Extent => Max - Min;
+
+    public bool IsEmpty => Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z;
+
+    public float SurfaceArea
+    {
+        get
+        {
+            if (IsEmpty)
+            {
+                return 0.0f;
+            }
+
+            var extent = Extent;
+            return 2.0f * (extent.X * extent.Y + extent.Y * extent.Z + extent.Z * extent.X);
+        }
+    }
+
+    public BoundingBox Union(BoundingBox other)
+    {
+        return new BoundingBox
+        {
+            Min = Vector3.Min(Min, other.Min),
+            Max = Vector3.Max(Max, other.Max)
+        };
+    }
+
+    public BoundingBox Union(Vector3 point)
+    {
+        return new BoundingBox
+        {
+            Min = Vector3.Min(Min, point),
+            Max = Vector3.Max(Max, point)
+        };
+    }
+
+    public static BoundingBox FromSphere(Sphere sphere)
+    {
+        var radius = new Vector3(MathF.Abs(sphere.Radius));
+
+        return new BoundingBox
+        {
+            Min = sphere.Position - radius,
+            Max = sphere.Position + radius
+        };
+    }
+}
@@ -0,0 +1,683 @@
+using System.Runtime.CompilerServices;
+
+namespace PathTracer.Core;
+
+public class BoundingVolumeHierarchy
+{
+    private const int BinCount = 16;
+    private const float TraversalCost = 1.0f;
+
+    private static readonly int MaxLeafPrimitiveCount = Math.Max(8, PackedSpheres.LaneCount);
+
+    private readonly BoundingVolumeHierarchyNode[] _nodes;
+    private readonly int[] _primitiveIndices;
+    private readonly PackedSpheres _primitives;
+
+    // NOTE: Only allocated on the first refit
+    private int[]? _parentIndices;
+    private int[]? _leafIndices;
+    private int[]? _primitivePositions;
+
+    private BoundingVolumeHierarchy(BoundingVolumeHierarchyNode[] nodes, int nodeCount, int maxDepth, int[] primitiveIndices, PackedSpheres primitives)
+    {
+        _nodes = nodes;
+        _primitiveIndices = primitiveIndices;
+        _primitives = primitives;
+
+        NodeCount = nodeCount;
+        MaxDepth = maxDepth;
+    }
+
+    public int NodeCount { get; }
+    public int MaxDepth { get; }
+    public ReadOnlySpan<BoundingVolumeHierarchyNode> Nodes => _nodes.AsSpan(0, NodeCount);
+    public ReadOnlySpan<int> PrimitiveIndices => _primitiveIndices;
+    public BoundingBox Bounds => NodeCount > 0 ? new BoundingBox { Min = _nodes[0].BoundsMin, Max = _nodes[0].BoundsMax } : new BoundingBox();
+
+    public static BoundingVolumeHierarchy Build(IList<Sphere> spheres)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+
+        var primitiveBounds = new BoundingBox[spheres.Count];
+
+        for (var i = 0; i < primitiveBounds.Length; i++)
+        {
+            primitiveBounds[i] = BoundingBox.FromSphere(spheres[i]);
+        }
+
+        var nodes = BuildNodes(primitiveBounds, MaxLeafPrimitiveCount, PackedSpheres.LaneCount, out var primitiveIndices, out var nodeCount, out var maxDepth);
+
+        // Store the primitives in the traversal order so leaves read contiguous memory
+        var primitives = PackedSpheres.Create(spheres, primitiveIndices);
+
+        return new BoundingVolumeHierarchy(nodes, nodeCount, maxDepth, primitiveIndices, primitives);
+    }
+
+    // NOTE: Creates the hierarchy from nodes built ahead of time, for example loaded from a scene file.
+    // The nodes are validated so a corrupted hierarchy cannot index outside of the arrays, and
+    // maxDepth must be the real depth because it sizes the traversal stacks.
+    public static BoundingVolumeHierarchy Create(IList<Sphere> spheres, BoundingVolumeHierarchyNode[] nodes, int[] primitiveIndices, int maxDepth)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+        ArgumentNullException.ThrowIfNull(nodes);
+        ArgumentNullException.ThrowIfNull(primitiveIndices);
+        ArgumentOutOfRangeException.ThrowIfNegative(maxDepth);
+
+        if (primitiveIndices.Length != spheres.Count)
+        {
+            throw new ArgumentException("Primitive indices must contain every sphere.", nameof(primitiveIndices));
+        }
+
+        if ((nodes.Length == 0) != (spheres.Count == 0) || (nodes.Length > 0 && maxDepth == 0))
+        {
+            throw new ArgumentException("Hierarchy must have a root node when the scene has spheres.", nameof(nodes));
+        }
+
+        // Children always come after their parent so the depths are known in a single pass
+        var nodeDepths = new int[nodes.Length];
+        var hierarchyDepth = 0;
+
+        if (nodes.Length > 0)
+        {
+            nodeDepths[0] = 1;
+        }
+
+        for (var i = 0; i < nodes.Length; i++)
+        {
+            var node = nodes[i];
+            var isValid = node.IsLeaf ? node.FirstIndex >= 0 && node.PrimitiveCount <= primitiveIndices.Length - node.FirstIndex
+                                      : node.FirstIndex > i && node.FirstIndex < nodes.Length - 1;
+
+            if (!isValid)
+            {
+                throw new ArgumentException($"Node {i} references elements outside of the hierarchy.", nameof(nodes));
+            }
+
+            if (nodeDepths[i] == 0)
+            {
+                continue;
+            }
+
+            hierarchyDepth = Math.Max(hierarchyDepth, nodeDepths[i]);
+
+            if (!node.IsLeaf)
+            {
+                nodeDepths[node.FirstIndex] = Math.Max(nodeDepths[node.FirstIndex], nodeDepths[i] + 1);
+                nodeDepths[node.FirstIndex + 1] = Math.Max(nodeDepths[node.FirstIndex + 1], nodeDepths[i] + 1);
+            }
+        }
+
+        if (maxDepth != hierarchyDepth)
+        {
+            throw new ArgumentException($"Max depth {maxDepth} is different from the depth {hierarchyDepth} of the hierarchy.", nameof(maxDepth));
+        }
+
+        var isPrimitiveReferenced = new bool[spheres.Count];
+
+        foreach (var primitiveIndex in primitiveIndices)
+        {
+            if (primitiveIndex < 0 || primitiveIndex >= spheres.Count)
+            {
+                throw new ArgumentException($"Primitive index {primitiveIndex} is outside of the spheres.", nameof(primitiveIndices));
+            }
+
+            if (isPrimitiveReferenced[primitiveIndex])
+            {
+                throw new ArgumentException($"Primitive index {primitiveIndex} is referenced more than once.", nameof(primitiveIndices));
+            }
+
+            isPrimitiveReferenced[primitiveIndex] = true;
+        }
+
+        var primitives = PackedSpheres.Create(spheres, primitiveIndices);
+        return new BoundingVolumeHierarchy(nodes, nodes.Length, maxDepth, primitiveIndices, primitives);
+    }
+
+    // NOTE: Copy that is not affected by the refits of this hierarchy, the primitive indices
+    // are shared since the topology never changes
+    public BoundingVolumeHierarchy Clone()
+    {
+        return new BoundingVolumeHierarchy(Nodes.ToArray(), NodeCount, MaxDepth, _primitiveIndices, _primitives.Clone());
+    }
+
+    // NOTE: Updates the bounds of the leaves that contain the given spheres and of their
+    // ancestors without changing the topology. Ancestors are only visited until their bounds
+    // stay the same, so moving a few spheres costs a few paths to the root. The quality of
+    // the hierarchy degrades when spheres move far from where it was built, large edits
+    // should build a new hierarchy instead.
+    public void Refit(IList<Sphere> spheres, IEnumerable<int> objectIndices)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+        ArgumentNullException.ThrowIfNull(objectIndices);
+
+        if (spheres.Count != _primitiveIndices.Length)
+        {
+            throw new ArgumentException("Spheres must be the ones used to build the hierarchy.", nameof(spheres));
+        }
+
+        if (_parentIndices is null)
+        {
+            CreateRefitIndices();
+        }
+
+        var nodes = _nodes.AsSpan(0, NodeCount);
+
+        foreach (var objectIndex in objectIndices)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(objectIndex);
+            ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(objectIndex, spheres.Count);
+
+            var primitivePosition = _primitivePositions![objectIndex];
+            _primitives.Update(primitivePosition, spheres[objectIndex]);
+
+            var nodeIndex = _leafIndices![primitivePosition];
+            var leaf = nodes[nodeIndex];
+            var bounds = new BoundingBox();
+
+            for (var i = leaf.FirstIndex; i < leaf.FirstIndex + leaf.PrimitiveCount; i++)
+            {
+                bounds = bounds.Union(BoundingBox.FromSphere(spheres[_primitiveIndices[i]]));
+            }
+
+            nodes[nodeIndex] = leaf with { BoundsMin = bounds.Min, BoundsMax = bounds.Max };
+
+            for (nodeIndex = _parentIndices![nodeIndex]; nodeIndex >= 0; nodeIndex = _parentIndices[nodeIndex])
+            {
+                var node = nodes[nodeIndex];
+                var leftChild = nodes[node.FirstIndex];
+                var rightChild = nodes[node.FirstIndex + 1];
+
+                var boundsMin = Vector3.Min(leftChild.BoundsMin, rightChild.BoundsMin);
+                var boundsMax = Vector3.Max(leftChild.BoundsMax, rightChild.BoundsMax);
+
+                if (boundsMin == node.BoundsMin && boundsMax == node.BoundsMax)
+                {
+                    break;
+                }
+
+                nodes[nodeIndex] = node with { BoundsMin = boundsMin, BoundsMax = boundsMax };
+            }
+        }
+    }
+
+    public bool Intersect(Ray ray, out float hitDistance, out int objectIndex)
+    {
+        var intersectionTestCount = 0L;
+        return Intersect(ray, out hitDistance, out objectIndex, ref intersectionTestCount);
+    }
+
+    // NOTE: intersectionTestCount is incremented by the number of primitives tested
+    public bool Intersect(Ray ray, out float hitDistance, out int objectIndex, ref long intersectionTestCount)
+    {
+        hitDistance = float.MaxValue;
+        objectIndex = -1;
+
+        return IntersectClosest(ray, ref hitDistance, ref objectIndex, ref intersectionTestCount);
+    }
+
+    // NOTE: Only hits closer than hitDistance are reported, so the closest hit of several
+    // hierarchies is found by intersecting them one after the other. Returns false when
+    // no closer hit was found, hitDistance and objectIndex are then unchanged.
+    public bool IntersectClosest(Ray ray, ref float hitDistance, ref int objectIndex, ref long intersectionTestCount)
+    {
+        var leafIntersector = new SphereLeafIntersector(_primitives, objectIndex);
+        var isHit = Traverse(Nodes, MaxDepth, ray, ref hitDistance, ref leafIntersector);
+
+        objectIndex = leafIntersector.ObjectIndex;
+        intersectionTestCount += leafIntersector.IntersectionTestCount;
+
+        return isHit;
+    }
+
+    // NOTE: Occlusion query for shadow rays, it stops at the first hit closer than hitDistance
+    // instead of searching the closest one. hitDistance is then the distance of that hit.
+    public bool IntersectAny(Ray ray, ref float hitDistance, ref long intersectionTestCount)
+    {
+        var leafIntersector = new SphereLeafIntersector(_primitives, -1);
+        var isHit = TraverseAny(Nodes, MaxDepth, ray, ref hitDistance, ref leafIntersector);
+
+        intersectionTestCount += leafIntersector.IntersectionTestCount;
+
+        return isHit;
+    }
+
+    // NOTE: Builds the nodes over the bounds of any kind of primitive. laneCount is the number
+    // of primitives a leaf tests at once, it scales the cost of the leaves in the split heuristic.
+    internal static BoundingVolumeHierarchyNode[] BuildNodes(BoundingBox[] primitiveBounds, int maxLeafPrimitiveCount, int laneCount, out int[] primitiveIndices, out int nodeCount, out int maxDepth)
+    {
+        var primitiveCount = primitiveBounds.Length;
+        var centroids = new Vector3[primitiveCount];
+
+        primitiveIndices = new int[primitiveCount];
+
+        for (var i = 0; i < primitiveCount; i++)
+        {
+            centroids[i] = primitiveBounds[i].Center;
+            primitiveIndices[i] = i;
+        }
+
+        var nodes = new BoundingVolumeHierarchyNode[Math.Max(1, 2 * primitiveCount - 1)];
+        nodeCount = 0;
+        maxDepth = 0;
+
+        if (primitiveCount == 0)
+        {
+            return nodes;
+        }
+
+        var buildStack = new Stack<(int NodeIndex, int FirstIndex, int PrimitiveCount, int Depth)>();
+        buildStack.Push((0, 0, primitiveCount, 1));
+        nodeCount = 1;
+
+        while (buildStack.Count > 0)
+        {
+            var (nodeIndex, firstIndex, count, depth) = buildStack.Pop();
+            maxDepth = Math.Max(maxDepth, depth);
+
+            var bounds = new BoundingBox();
+            var centroidBounds = new BoundingBox();
+
+            for (var i = firstIndex; i < firstIndex + count; i++)
+            {
+                bounds = bounds.Union(primitiveBounds[primitiveIndices[i]]);
+                centroidBounds = centroidBounds.Union(centroids[primitiveIndices[i]]);
+            }
+
+            var leftCount = 0;
+
+            if (count > 1)
+            {
+                var split = FindBestSplit(primitiveBounds, centroids, primitiveIndices.AsSpan(firstIndex, count), centroidBounds, laneCount);
+                var leafCost = GetIntersectionCost(count, laneCount);
+                var splitCost = TraversalCost + split.Cost / MathF.Max(bounds.SurfaceArea, float.Epsilon);
+
+                if (split.Axis >= 0 && (splitCost < leafCost || count > maxLeafPrimitiveCount))
+                {
+                    leftCount = Partition(centroids, primitiveIndices.AsSpan(firstIndex, count), centroidBounds, split.Axis, split.BinIndex);
+                }
+
+                // NOTE: Fallback to a median split when the primitives are too big for a leaf
+                // and the centroids are all packed in the same bin
+                if ((leftCount == 0 || leftCount == count) && count > maxLeafPrimitiveCount)
+                {
+                    leftCount = count / 2;
+                }
+            }
+
+            if (leftCount == 0 || leftCount == count)
+            {
+                nodes[nodeIndex] = new BoundingVolumeHierarchyNode
+                {
+                    BoundsMin = bounds.Min,
+                    BoundsMax = bounds.Max,
+                    FirstIndex = firstIndex,
+                    PrimitiveCount = count
+                };
+
+                continue;
+            }
+
+            var leftChildIndex = nodeCount;
+            nodeCount += 2;
+
+            nodes[nodeIndex] = new BoundingVolumeHierarchyNode
+            {
+                BoundsMin = bounds.Min,
+                BoundsMax = bounds.Max,
+                FirstIndex = leftChildIndex,
+                PrimitiveCount = 0
+            };
+
+            buildStack.Push((leftChildIndex + 1, firstIndex + leftCount, count - leftCount, depth + 1));
+            buildStack.Push((leftChildIndex, firstIndex, leftCount, depth + 1));
+        }
+
+        return nodes;
+    }
+
+    // NOTE: Front to back traversal shared by the sphere and instance hierarchies, the leaf
+    // intersector is a struct so the leaf test is specialized and inlined for each of them.
+    internal static bool Traverse<TLeafIntersector>(ReadOnlySpan<BoundingVolumeHierarchyNode> nodes, int maxDepth, Ray ray, ref float hitDistance, ref TLeafIntersector leafIntersector) where TLeafIntersector : struct, ILeafIntersector
+    {
+        if (nodes.IsEmpty)
+        {
+            return false;
+        }
+
+        var initialHitDistance = hitDistance;
+        var inverseDirection = Vector3.One / ray.Direction;
+
+        if (IntersectBounds(nodes[0], ray.Origin, inverseDirection, hitDistance) == float.PositiveInfinity)
+        {
+            return false;
+        }
+
+        Span<int> nodeStack = stackalloc int[maxDepth];
+        Span<float> distanceStack = stackalloc float[maxDepth];
+        var stackSize = 0;
+        var nodeIndex = 0;
+
+        while (true)
+        {
+            ref readonly var node = ref nodes[nodeIndex];
+
+            if (node.IsLeaf)
+            {
+                leafIntersector.Intersect(ray, node.FirstIndex, node.PrimitiveCount, ref hitDistance);
+            }
+            else
+            {
+                var nearIndex = node.FirstIndex;
+                var farIndex = node.FirstIndex + 1;
+
+                var nearDistance = IntersectBounds(nodes[nearIndex], ray.Origin, inverseDirection, hitDistance);
+                var farDistance = IntersectBounds(nodes[farIndex], ray.Origin, inverseDirection, hitDistance);
+
+                if (farDistance < nearDistance)
+                {
+                    (nearIndex, farIndex) = (farIndex, nearIndex);
+                    (nearDistance, farDistance) = (farDistance, nearDistance);
+                }
+
+                if (nearDistance != float.PositiveInfinity)
+                {
+                    if (farDistance != float.PositiveInfinity)
+                    {
+                        nodeStack[stackSize] = farIndex;
+                        distanceStack[stackSize] = farDistance;
+                        stackSize++;
+                    }
+
+                    nodeIndex = nearIndex;
+                    continue;
+                }
+            }
+
+            // Pop the next node that can still contain a closer hit
+            nodeIndex = -1;
+
+            while (stackSize > 0)
+            {
+                stackSize--;
+
+                if (distanceStack[stackSize] < hitDistance)
+                {
+                    nodeIndex = nodeStack[stackSize];
+                    break;
+                }
+            }
+
+            if (nodeIndex == -1)
+            {
+                break;
+            }
+        }
+
+        return hitDistance < initialHitDistance;
+    }
+
+    // NOTE: Any hit traversal, the first leaf with a hit ends it so children are not sorted
+    // by distance and the stack doesn't need the distances
+    internal static bool TraverseAny<TLeafIntersector>(ReadOnlySpan<BoundingVolumeHierarchyNode> nodes, int maxDepth, Ray ray, ref float hitDistance, ref TLeafIntersector leafIntersector) where TLeafIntersector : struct, ILeafIntersector
+    {
+        if (nodes.IsEmpty)
+        {
+            return false;
+        }
+
+        var initialHitDistance = hitDistance;
+        var inverseDirection = Vector3.One / ray.Direction;
+
+        if (IntersectBounds(nodes[0], ray.Origin, inverseDirection, hitDistance) == float.PositiveInfinity)
+        {
+            return false;
+        }
+
+        Span<int> nodeStack = stackalloc int[maxDepth];
+        var stackSize = 0;
+        var nodeIndex = 0;
+
+        while (true)
+        {
+            ref readonly var node = ref nodes[nodeIndex];
+
+            if (node.IsLeaf)
+            {
+                leafIntersector.Intersect(ray, node.FirstIndex, node.PrimitiveCount, ref hitDistance);
+
+                if (hitDistance < initialHitDistance)
+                {
+                    return true;
+                }
+            }
+            else
+            {
+                var leftIndex = node.FirstIndex;
+                var rightIndex = node.FirstIndex + 1;
+
+                var isLeftHit = IntersectBounds(nodes[leftIndex], ray.Origin, inverseDirection, hitDistance) != float.PositiveInfinity;
+                var isRightHit = IntersectBounds(nodes[rightIndex], ray.Origin, inverseDirection, hitDistance) != float.PositiveInfinity;
+
+                if (isLeftHit && isRightHit)
+                {
+                    nodeStack[stackSize] = rightIndex;
+                    stackSize++;
+                }
+
+                if (isLeftHit || isRightHit)
+                {
+                    nodeIndex = isLeftHit ? leftIndex : rightIndex;
+                    continue;
+                }
+            }
+
+            if (stackSize == 0)
+            {
+                return false;
+            }
+
+            stackSize--;
+            nodeIndex = nodeStack[stackSize];
+        }
+    }
+
+    private static (int Axis, int BinIndex, float Cost) FindBestSplit(BoundingBox[] primitiveBounds, Vector3[] centroids, ReadOnlySpan<int> primitiveIndices, BoundingBox centroidBounds, int laneCount)
+    {
+        Span<int> binCounts = stackalloc int[BinCount];
+        Span<Vector3> binMins = stackalloc Vector3[BinCount];
+        Span<Vector3> binMaxs = stackalloc Vector3[BinCount];
+        Span<float> rightCosts = stackalloc float[BinCount];
+
+        var bestAxis = -1;
+        var bestBinIndex = 0;
+        var bestCost = float.MaxValue;
+
+        for (var axis = 0; axis < 3; axis++)
+        {
+            var axisMin = GetAxis(centroidBounds.Min, axis);
+            var axisExtent = GetAxis(centroidBounds.Max, axis) - axisMin;
+
+            if (axisExtent <= 0.0f)
+            {
+                continue;
+            }
+
+            binCounts.Clear();
+            binMins.Fill(new Vector3(float.MaxValue));
+            binMaxs.Fill(new Vector3(float.MinValue));
+
+            var binScale = BinCount / axisExtent;
+
+            foreach (var primitiveIndex in primitiveIndices)
+            {
+                var binIndex = GetBinIndex(GetAxis(centroids[primitiveIndex], axis), axisMin, binScale);
+                ref readonly var bounds = ref primitiveBounds[primitiveIndex];
+
+                binCounts[binIndex]++;
+                binMins[binIndex] = Vector3.Min(binMins[binIndex], bounds.Min);
+                binMaxs[binIndex] = Vector3.Max(binMaxs[binIndex], bounds.Max);
+            }
+
+            // Sweep from the right to get the cost of every right partition, then from the left
+            var rightMin = new Vector3(float.MaxValue);
+            var rightMax = new Vector3(float.MinValue);
+            var rightCount = 0;
+
+            for (var i = BinCount - 1; i > 0; i--)
+            {
+                rightMin = Vector3.Min(rightMin, binMins[i]);
+                rightMax = Vector3.Max(rightMax, binMaxs[i]);
+                rightCount += binCounts[i];
+                rightCosts[i] = rightCount > 0 ? GetIntersectionCost(rightCount, laneCount) * GetSurfaceArea(rightMin, rightMax) : 0.0f;
+            }
+
+            var leftMin = new Vector3(float.MaxValue);
+            var leftMax = new Vector3(float.MinValue);
+            var leftCount = 0;
+
+            for (var i = 1; i < BinCount; i++)
+            {
+                leftMin = Vector3.Min(leftMin, binMins[i - 1]);
+                leftMax = Vector3.Max(leftMax, binMaxs[i - 1]);
+                leftCount += binCounts[i - 1];
+
+                if (leftCount == 0 || leftCount == primitiveIndices.Length)
+                {
+                    continue;
+                }
+
+                var cost = GetIntersectionCost(leftCount, laneCount) * GetSurfaceArea(leftMin, leftMax) + rightCosts[i];
+
+                if (cost < bestCost)
+                {
+                    bestAxis = axis;
+                    bestBinIndex = i;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        return (bestAxis, bestBinIndex, bestCost);
+    }
+
+    private static int Partition(Vector3[] centroids, Span<int> primitiveIndices, BoundingBox centroidBounds, int axis, int splitBinIndex)
+    {
+        var axisMin = GetAxis(centroidBounds.Min, axis);
+        var binScale = BinCount / (GetAxis(centroidBounds.Max, axis) - axisMin);
+
+        var i = 0;
+        var j = primitiveIndices.Length - 1;
+
+        while (i <= j)
+        {
+            if (GetBinIndex(GetAxis(centroids[primitiveIndices[i]], axis), axisMin, binScale) < splitBinIndex)
+            {
+                i++;
+            }
+            else
+            {
+                (primitiveIndices[i], primitiveIndices[j]) = (primitiveIndices[j], primitiveIndices[i]);
+                j--;
+            }
+        }
+
+        return i;
+    }
+
+    private static int GetBinIndex(float value, float axisMin, float binScale)
+    {
+        return Math.Clamp((int)((value - axisMin) * binScale), 0, BinCount - 1);
+    }
+
+    private void CreateRefitIndices()
+    {
+        var parentIndices = new int[NodeCount];
+        var leafIndices = new int[_primitiveIndices.Length];
+        var primitivePositions = new int[_primitiveIndices.Length];
+
+        parentIndices.AsSpan().Fill(-1);
+
+        for (var i = 0; i < NodeCount; i++)
+        {
+            var node = _nodes[i];
+
+            if (node.IsLeaf)
+            {
+                leafIndices.AsSpan(node.FirstIndex, node.PrimitiveCount).Fill(i);
+            }
+            else
+            {
+                parentIndices[node.FirstIndex] = i;
+                parentIndices[node.FirstIndex + 1] = i;
+            }
+        }
+
+        for (var i = 0; i < _primitiveIndices.Length; i++)
+        {
+            primitivePositions[_primitiveIndices[i]] = i;
+        }
+
+        _parentIndices = parentIndices;
+        _leafIndices = leafIndices;
+        _primitivePositions = primitivePositions;
+    }
+
+    // NOTE: Leaves test laneCount primitives at once so the cost is the number of batches
+    private static float GetIntersectionCost(int primitiveCount, int laneCount)
+    {
+        return (primitiveCount + laneCount - 1) / laneCount;
+    }
+
+    private static float GetSurfaceArea(Vector3 boundsMin, Vector3 boundsMax)
+    {
+        var extent = boundsMax - boundsMin;
+        return 2.0f * (extent.X * extent.Y + extent.Y * extent.Z + extent.Z * extent.X);
+    }
+
+    private static float GetAxis(Vector3 value, int axis)
+    {
+        return axis switch
+        {
+            0 => value.X,
+            1 => value.Y,
+            _ => value.Z
+        };
+    }
+
+    private static float IntersectBounds(in BoundingVolumeHierarchyNode node, Vector3 rayOrigin, Vector3 inverseDirection, float maxDistance)
+    {
+        var t1 = (node.BoundsMin - rayOrigin) * inverseDirection;
+        var t2 = (node.BoundsMax - rayOrigin) * inverseDirection;
+
+        var tMin = Vector3.Min(t1, t2);
+        var tMax = Vector3.Max(t1, t2);
+
+        var entryDistance = MathF.Max(MathF.Max(tMin.X, tMin.Y), MathF.Max(tMin.Z, 0.0f));
+        var exitDistance = MathF.Min(MathF.Min(tMax.X, tMax.Y), MathF.Min(tMax.Z, maxDistance));
+
+        return entryDistance <= exitDistance ? entryDistance : float.PositiveInfinity;
+    }
+
+    private struct SphereLeafIntersector : ILeafIntersector
+    {
+        private readonly PackedSpheres _primitives;
+        private int _objectIndex;
+        private long _intersectionTestCount;
+
+        public SphereLeafIntersector(PackedSpheres primitives, int objectIndex)
+        {
+            _primitives = primitives;
+            _objectIndex = objectIndex;
+        }
+
+        public readonly int ObjectIndex => _objectIndex;
+        public readonly long IntersectionTestCount => _intersectionTestCount;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public void Intersect(Ray ray, int firstIndex, int count, ref float hitDistance)
+        {
+            _primitives.Intersect(ray, firstIndex, count, ref hitDistance, ref _objectIndex);
+            _intersectionTestCount += count;
+        }
+    }
+}
\ No newline at end of file
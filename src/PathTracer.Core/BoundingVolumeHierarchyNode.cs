@@ -0,0 +1,14 @@
+namespace PathTracer.Core;
+
+// NOTE: Layout is kept to 32 bytes so two sibling nodes fit in one cache line.
+// For inner nodes FirstIndex is the index of the left child and the right child
+// is stored right after it. For leaf nodes FirstIndex is the first primitive.
+public readonly record struct BoundingVolumeHierarchyNode
+{
+    public Vector3 BoundsMin { get; init; }
+    public int FirstIndex { get; init; }
+    public Vector3 BoundsMax { get; init; }
+    public int PrimitiveCount { get; init; }
+
+    public bool IsLeaf => PrimitiveCount > 0;
+}
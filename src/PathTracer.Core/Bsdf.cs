@@ -0,0 +1,207 @@
+namespace PathTracer.Core;
+
+// NOTE: Material model of the path tracer, a Lambert diffuse lobe under a GGX specular lobe
+// with the Smith height correlated visibility and the Schlick Fresnel. Dielectrics reflect
+// 4% at normal incidence, metals have no diffuse lobe and tint their reflection with the
+// albedo. Roughness is squared to get the GGX alpha. Directions point away from the surface
+// and the returned values include the cosine of the incoming direction.
+public static class Bsdf
+{
+    private const float DielectricReflectance = 0.04f;
+
+    // NOTE: A roughness of 0 is a mirror, the alpha is clamped so the distribution stays finite
+    private const float MinimumAlpha = 0.001f;
+
+    // NOTE: Smooth metals have no diffuse lobe, lights have no area so their specular lobe only
+    // reflects a light in a single direction and shadow rays would only add fireflies
+    public static bool IsMirror(in Material material)
+    {
+        return IsSmooth(material) && material.Metallic >= 1.0f;
+    }
+
+    public static Vector3 Evaluate(in Material material, Vector3 normal, Vector3 outgoing, Vector3 incoming)
+    {
+        return Evaluate(material, normal, outgoing, incoming, out _);
+    }
+
+    // NOTE: Value used by the shadow rays of the next event estimation, only the diffuse lobe of
+    // smooth materials is kept for the same reason as mirrors
+    public static Vector3 EvaluateLight(in Material material, Vector3 normal, Vector3 outgoing, Vector3 incoming)
+    {
+        if (!IsSmooth(material))
+        {
+            return Evaluate(material, normal, outgoing, incoming);
+        }
+
+        var cosIncoming = Vector3.Dot(normal, incoming);
+        var cosOutgoing = Vector3.Dot(normal, outgoing);
+
+        if (cosIncoming <= 0.0f || cosOutgoing <= 0.0f)
+        {
+            return Vector3.Zero;
+        }
+
+        var halfVector = Vector3.Normalize(incoming + outgoing);
+        var fresnel = GetFresnel(GetSpecularColor(material), MathF.Max(Vector3.Dot(outgoing, halfVector), 1e-6f));
+
+        return GetDiffuse(material, fresnel) * cosIncoming;
+    }
+
+    public static float GetPdf(in Material material, Vector3 normal, Vector3 outgoing, Vector3 incoming)
+    {
+        Evaluate(material, normal, outgoing, incoming, out var pdf);
+        return pdf;
+    }
+
+    // NOTE: random is in the [0, 1) range, its first component picks the lobe. The weight is
+    // the value divided by the pdf of both lobes. Returns false when the sampled direction is
+    // below the surface, the path ends there.
+    public static bool Sample(in Material material, Vector3 normal, Vector3 outgoing, Vector3 random, out Vector3 incoming, out Vector3 weight)
+    {
+        var cosOutgoing = Vector3.Dot(normal, outgoing);
+
+        if (random.X < GetSpecularProbability(material, cosOutgoing))
+        {
+            var halfVector = ToWorld(normal, SampleDistribution(GetAlpha(material.Roughness), random.Y, random.Z));
+            incoming = 2.0f * Vector3.Dot(outgoing, halfVector) * halfVector - outgoing;
+        }
+        else
+        {
+            incoming = ToWorld(normal, SampleCosine(random.Y, random.Z));
+        }
+
+        var value = Evaluate(material, normal, outgoing, incoming, out var pdf);
+
+        if (pdf <= 0.0f)
+        {
+            weight = Vector3.Zero;
+            return false;
+        }
+
+        weight = value / pdf;
+        return true;
+    }
+
+    private static Vector3 Evaluate(in Material material, Vector3 normal, Vector3 outgoing, Vector3 incoming, out float pdf)
+    {
+        var cosIncoming = Vector3.Dot(normal, incoming);
+        var cosOutgoing = Vector3.Dot(normal, outgoing);
+
+        if (cosIncoming <= 0.0f || cosOutgoing <= 0.0f)
+        {
+            pdf = 0.0f;
+            return Vector3.Zero;
+        }
+
+        var halfVector = Vector3.Normalize(incoming + outgoing);
+        var cosHalfVector = MathF.Max(Vector3.Dot(normal, halfVector), 0.0f);
+        var cosOutgoingHalfVector = MathF.Max(Vector3.Dot(outgoing, halfVector), 1e-6f);
+
+        var alpha = GetAlpha(material.Roughness);
+        var distribution = GetDistribution(alpha, cosHalfVector);
+        var fresnel = GetFresnel(GetSpecularColor(material), cosOutgoingHalfVector);
+
+        var specular = fresnel * (distribution * GetVisibility(alpha, cosOutgoing, cosIncoming));
+        var diffuse = GetDiffuse(material, fresnel);
+
+        var specularProbability = GetSpecularProbability(material, cosOutgoing);
+        var specularPdf = distribution * cosHalfVector / (4.0f * cosOutgoingHalfVector);
+        var diffusePdf = cosIncoming / MathF.PI;
+
+        pdf = diffusePdf + (specularPdf - diffusePdf) * specularProbability;
+        return (diffuse + specular) * cosIncoming;
+    }
+
+    // NOTE: Lobes are picked with the share of the light they reflect, the Fresnel of the
+    // macro surface is used as the estimate of the specular share
+    private static float GetSpecularProbability(in Material material, float cosOutgoing)
+    {
+        var specularWeight = GetLuminance(GetFresnel(GetSpecularColor(material), MathF.Max(cosOutgoing, 0.0f)));
+        var diffuseWeight = GetLuminance(material.Albedo) * (1.0f - material.Metallic) * (1.0f - specularWeight);
+        var totalWeight = specularWeight + diffuseWeight;
+
+        return totalWeight > 0.0f ? specularWeight / totalWeight : 1.0f;
+    }
+
+    // NOTE: The alpha of smooth materials is clamped
+    private static bool IsSmooth(in Material material)
+    {
+        return material.Roughness * material.Roughness <= MinimumAlpha;
+    }
+
+    private static float GetAlpha(float roughness)
+    {
+        return MathF.Max(roughness * roughness, MinimumAlpha);
+    }
+
+    private static Vector3 GetSpecularColor(in Material material)
+    {
+        return Vector3.Lerp(new Vector3(DielectricReflectance), material.Albedo, material.Metallic);
+    }
+
+    private static Vector3 GetDiffuse(in Material material, Vector3 fresnel)
+    {
+        return (Vector3.One - fresnel) * material.Albedo * ((1.0f - material.Metallic) / MathF.PI);
+    }
+
+    private static Vector3 GetFresnel(Vector3 specularColor, float cosTheta)
+    {
+        var factor = 1.0f - cosTheta;
+        var factorSquared = factor * factor;
+
+        return specularColor + (Vector3.One - specularColor) * (factorSquared * factorSquared * factor);
+    }
+
+    private static float GetDistribution(float alpha, float cosHalfVector)
+    {
+        var alphaSquared = alpha * alpha;
+        var denominator = cosHalfVector * cosHalfVector * (alphaSquared - 1.0f) + 1.0f;
+
+        return alphaSquared / (MathF.PI * denominator * denominator);
+    }
+
+    private static float GetVisibility(float alpha, float cosOutgoing, float cosIncoming)
+    {
+        var alphaSquared = alpha * alpha;
+        var outgoingTerm = cosIncoming * MathF.Sqrt(cosOutgoing * cosOutgoing * (1.0f - alphaSquared) + alphaSquared);
+        var incomingTerm = cosOutgoing * MathF.Sqrt(cosIncoming * cosIncoming * (1.0f - alphaSquared) + alphaSquared);
+
+        return 0.5f / (outgoingTerm + incomingTerm);
+    }
+
+    private static float GetLuminance(Vector3 color)
+    {
+        return Vector3.Dot(color, new Vector3(0.2126f, 0.7152f, 0.0722f));
+    }
+
+    private static Vector3 SampleCosine(float u, float v)
+    {
+        var radius = MathF.Sqrt(u);
+        var (sin, cos) = MathF.SinCos(2.0f * MathF.PI * v);
+
+        return new Vector3(radius * cos, radius * sin, MathF.Sqrt(MathF.Max(1.0f - u, 0.0f)));
+    }
+
+    private static Vector3 SampleDistribution(float alpha, float u, float v)
+    {
+        var cosThetaSquared = (1.0f - u) / (1.0f + (alpha * alpha - 1.0f) * u);
+        var sinTheta = MathF.Sqrt(MathF.Max(1.0f - cosThetaSquared, 0.0f));
+        var (sin, cos) = MathF.SinCos(2.0f * MathF.PI * v);
+
+        return new Vector3(sinTheta * cos, sinTheta * sin, MathF.Sqrt(cosThetaSquared));
+    }
+
+    // NOTE: Orthonormal basis around the normal from Duff et al. 2017, "Building an
+    // Orthonormal Basis, Revisited"
+    private static Vector3 ToWorld(Vector3 normal, Vector3 direction)
+    {
+        var sign = MathF.CopySign(1.0f, normal.Z);
+        var a = -1.0f / (sign + normal.Z);
+        var b = normal.X * normal.Y * a;
+
+        var tangent = new Vector3(1.0f + sign * normal.X * normal.X * a, sign * b, -sign * normal.X);
+        var bitangent = new Vector3(b, sign + normal.Y * normal.Y * a, -normal.Y);
+
+        return tangent * direction.X + bitangent * direction.Y + normal * direction.Z;
+    }
+}
\ No newline at end of file
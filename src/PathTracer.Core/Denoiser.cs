@@ -0,0 +1,350 @@
+namespace PathTracer.Core;
+
+// NOTE: Edge avoiding à-trous wavelet filter. Every pass filters the image with a 5x5 B3
+// spline kernel whose taps are spread by a step that doubles every pass, so a few passes of
+// 25 taps cover a wide footprint. Taps are weighted by their difference of color, albedo,
+// normal and depth with the center pixel so the edges of the geometry and of the materials
+// are kept. Materials have a single albedo so the color is filtered as is, the albedo only
+// separates the materials. The color weight gets narrower every pass and as the sample count
+// grows so converged images are barely changed.
+// The image is stored as one plane per channel so a tap of Vector<float>.Count neighbouring
+// pixels is a single load per channel. Rows are padded with zeros wide enough for the taps
+// of the last pass and taps outside of the image get a zero weight. Each pass is split in
+// tiles filtered by the workers of the tile scheduler.
+public sealed class Denoiser
+{
+    public const int PassCount = 5;
+
+    // NOTE: Tiles must be a multiple of the vector size so only the last tile of a row
+    // writes in the padding
+    private const int TileSize = 64;
+    private const int BandHeight = 16;
+    private const int PlaneCount = 13;
+    private const float MinimumDepth = 0.001f;
+    private const float ColorSigma = 1.0f;
+    private const float AlbedoSigma = 0.1f;
+    private const float NormalSigma = 0.5f;
+
+    // NOTE: Relative to the depth of the center pixel
+    private const float DepthSigma = 0.1f;
+
+    private static readonly float[] _kernel = [1.0f / 16.0f, 1.0f / 4.0f, 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f];
+    private static readonly Vector<float> _laneOffsets = CreateLaneOffsets();
+
+    private readonly RenderBufferPool? _bufferPool;
+
+    public Denoiser() : this(null)
+    {
+    }
+
+    public Denoiser(RenderBufferPool? bufferPool)
+    {
+        _bufferPool = bufferPool;
+    }
+
+    // NOTE: Distance of the farthest tap of the last pass, pixels closer than this to the
+    // edge of a region are filtered with fewer neighbours
+    public static int Radius => 2 * ((1 << PassCount) - 1);
+
+    // NOTE: The denoised image is written to the destination as a single frame so it is
+    // resolved like any render. 0 threads uses all the logical processors.
+    public void Denoise(AccumulationBuffer source, AccumulationBuffer destination, int threadCount, CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(source);
+        ArgumentNullException.ThrowIfNull(destination);
+        ArgumentOutOfRangeException.ThrowIfNegative(threadCount);
+
+        if (!source.HasFeatures)
+        {
+            throw new ArgumentException("Accumulation buffer must have features.", nameof(source));
+        }
+
+        if (source.FrameCount == 0)
+        {
+            throw new ArgumentException("Accumulation buffer must have samples.", nameof(source));
+        }
+
+        if (destination == source || destination.Width != source.Width || destination.Height != source.Height)
+        {
+            throw new ArgumentException("Destination must be another accumulation buffer of the same size.", nameof(destination));
+        }
+
+        var layout = new PlaneLayout(source.Width, source.Height);
+        var workerCount = threadCount > 0 ? threadCount : Environment.ProcessorCount;
+        var planes = Rent<float>(layout.PlaneLength * PlaneCount);
+
+        try
+        {
+            TileScheduler.Run(CreateBands(layout.Width, layout.Height), workerCount, () => new ResolveRows(layout.Width), (band, rows) => ResolveBand(band, source, layout, planes, rows), cancellationToken);
+
+            var tiles = TileScheduler.CreateTiles(layout.Width, layout.Height, TileSize, TileOrder.Scanline);
+            var inputPlane = PlaneLayout.FirstColorPlane;
+            var outputPlane = PlaneLayout.SecondColorPlane;
+
+            // The noise of the average decreases with the square root of the sample count
+            var colorVariance = ColorSigma * ColorSigma / source.FrameCount;
+
+            for (var pass = 0; pass < PassCount; pass++)
+            {
+                var step = 1 << pass;
+                var inverseColorVariance = 1.0f / colorVariance;
+                var input = inputPlane;
+                var output = outputPlane;
+
+                TileScheduler.Run(tiles, workerCount, static () => 0, (tile, _) => FilterTile(tile, layout, planes, input, output, step, inverseColorVariance), cancellationToken);
+
+                (inputPlane, outputPlane) = (outputPlane, inputPlane);
+                colorVariance *= 0.25f;
+            }
+
+            WriteDestination(destination, layout, planes, inputPlane);
+        }
+        finally
+        {
+            Return(planes);
+        }
+    }
+
+    private static Tile[] CreateBands(int width, int height)
+    {
+        var bands = new Tile[(height + BandHeight - 1) / BandHeight];
+
+        for (var i = 0; i < bands.Length; i++)
+        {
+            bands[i] = new Tile { X = 0, Y = i * BandHeight, Width = width, Height = Math.Min(BandHeight, height - i * BandHeight) };
+        }
+
+        return bands;
+    }
+
+    private static void ResolveBand(Tile band, AccumulationBuffer source, PlaneLayout layout, float[] planes, ResolveRows rows)
+    {
+        for (var y = band.Y; y < band.Y + band.Height; y++)
+        {
+            source.ResolveRow(y, rows.Colors);
+            source.ResolveFeaturesRow(y, rows.Features);
+
+            // Padding has to be zero for every plane, rented arrays are not cleared
+            for (var plane = 0; plane < PlaneCount; plane++)
+            {
+                planes.AsSpan(layout.GetIndex(plane, -layout.Padding, y), layout.RowStride).Clear();
+            }
+
+            for (var x = 0; x < layout.Width; x++)
+            {
+                var color = rows.Colors[x];
+                var features = rows.Features[x];
+
+                planes[layout.GetIndex(PlaneLayout.FirstColorPlane, x, y)] = color.X;
+                planes[layout.GetIndex(PlaneLayout.FirstColorPlane + 1, x, y)] = color.Y;
+                planes[layout.GetIndex(PlaneLayout.FirstColorPlane + 2, x, y)] = color.Z;
+                planes[layout.GetIndex(PlaneLayout.AlbedoPlane, x, y)] = features.Albedo.X;
+                planes[layout.GetIndex(PlaneLayout.AlbedoPlane + 1, x, y)] = features.Albedo.Y;
+                planes[layout.GetIndex(PlaneLayout.AlbedoPlane + 2, x, y)] = features.Albedo.Z;
+                planes[layout.GetIndex(PlaneLayout.NormalPlane, x, y)] = features.Normal.X;
+                planes[layout.GetIndex(PlaneLayout.NormalPlane + 1, x, y)] = features.Normal.Y;
+                planes[layout.GetIndex(PlaneLayout.NormalPlane + 2, x, y)] = features.Normal.Z;
+                planes[layout.GetIndex(PlaneLayout.DepthPlane, x, y)] = features.Depth;
+            }
+        }
+    }
+
+    private static void WriteDestination(AccumulationBuffer destination, PlaneLayout layout, float[] planes, int colorPlane)
+    {
+        var row = new Vector4[layout.Width];
+
+        destination.Reset();
+
+        for (var y = 0; y < layout.Height; y++)
+        {
+            for (var x = 0; x < layout.Width; x++)
+            {
+                row[x] = new Vector4(planes[layout.GetIndex(colorPlane, x, y)], planes[layout.GetIndex(colorPlane + 1, x, y)], planes[layout.GetIndex(colorPlane + 2, x, y)], 1.0f);
+            }
+
+            destination.CopyRegion(new Tile { X = 0, Y = y, Width = layout.Width, Height = 1 }, 1, row);
+        }
+    }
+
+    private static void FilterTile(Tile tile, PlaneLayout layout, float[] planes, int inputPlane, int outputPlane, int step, float inverseColorVariance)
+    {
+        var planeLength = layout.PlaneLength;
+        var laneCount = Vector<float>.Count;
+
+        var inverseColorVarianceVector = new Vector<float>(inverseColorVariance);
+        var inverseAlbedoVariance = new Vector<float>(1.0f / (AlbedoSigma * AlbedoSigma));
+        var inverseNormalVariance = new Vector<float>(1.0f / (NormalSigma * NormalSigma));
+        var minimumSquaredDepth = new Vector<float>(MinimumDepth * MinimumDepth);
+        var width = new Vector<float>(layout.Width);
+
+        for (var y = tile.Y; y < tile.Y + tile.Height; y++)
+        {
+            for (var x = tile.X; x < tile.X + tile.Width; x += laneCount)
+            {
+                var colorIndex = layout.GetIndex(inputPlane, x, y);
+                var featureIndex = layout.GetIndex(PlaneLayout.AlbedoPlane, x, y);
+
+                var red = new Vector<float>(planes, colorIndex);
+                var green = new Vector<float>(planes, colorIndex + planeLength);
+                var blue = new Vector<float>(planes, colorIndex + planeLength * 2);
+                var albedoRed = new Vector<float>(planes, featureIndex);
+                var albedoGreen = new Vector<float>(planes, featureIndex + planeLength);
+                var albedoBlue = new Vector<float>(planes, featureIndex + planeLength * 2);
+                var normalX = new Vector<float>(planes, featureIndex + planeLength * 3);
+                var normalY = new Vector<float>(planes, featureIndex + planeLength * 4);
+                var normalZ = new Vector<float>(planes, featureIndex + planeLength * 5);
+                var depth = new Vector<float>(planes, featureIndex + planeLength * 6);
+
+                var inverseDepthVariance = Vector<float>.One / (Vector.Max(depth * depth, minimumSquaredDepth) * (DepthSigma * DepthSigma));
+
+                var redSum = Vector<float>.Zero;
+                var greenSum = Vector<float>.Zero;
+                var blueSum = Vector<float>.Zero;
+                var weightSum = Vector<float>.Zero;
+
+                for (var i = 0; i < _kernel.Length; i++)
+                {
+                    var offsetY = (i - _kernel.Length / 2) * step;
+
+                    if (y + offsetY < 0 || y + offsetY >= layout.Height)
+                    {
+                        continue;
+                    }
+
+                    for (var j = 0; j < _kernel.Length; j++)
+                    {
+                        var offsetX = (j - _kernel.Length / 2) * step;
+                        var sampleColorIndex = colorIndex + offsetY * layout.RowStride + offsetX;
+                        var sampleFeatureIndex = featureIndex + offsetY * layout.RowStride + offsetX;
+
+                        var sampleRed = new Vector<float>(planes, sampleColorIndex);
+                        var sampleGreen = new Vector<float>(planes, sampleColorIndex + planeLength);
+                        var sampleBlue = new Vector<float>(planes, sampleColorIndex + planeLength * 2);
+
+                        var colorDistance = Square(sampleRed - red) + Square(sampleGreen - green) + Square(sampleBlue - blue);
+                        var albedoDistance = Square(new Vector<float>(planes, sampleFeatureIndex) - albedoRed)
+                                           + Square(new Vector<float>(planes, sampleFeatureIndex + planeLength) - albedoGreen)
+                                           + Square(new Vector<float>(planes, sampleFeatureIndex + planeLength * 2) - albedoBlue);
+                        var normalDistance = Square(new Vector<float>(planes, sampleFeatureIndex + planeLength * 3) - normalX)
+                                           + Square(new Vector<float>(planes, sampleFeatureIndex + planeLength * 4) - normalY)
+                                           + Square(new Vector<float>(planes, sampleFeatureIndex + planeLength * 5) - normalZ);
+                        var depthDistance = Square(new Vector<float>(planes, sampleFeatureIndex + planeLength * 6) - depth);
+
+                        var exponent = colorDistance * inverseColorVarianceVector + albedoDistance * inverseAlbedoVariance + normalDistance * inverseNormalVariance + depthDistance * inverseDepthVariance;
+                        var weight = ExpNegative(exponent) * (_kernel[i] * _kernel[j]);
+
+                        // Taps in the padding read zeros and don't count
+                        if (x + offsetX < 0 || x + offsetX + laneCount > layout.Width)
+                        {
+                            var sampleX = _laneOffsets + new Vector<float>(x + offsetX);
+                            weight = Vector.ConditionalSelect(Vector.GreaterThanOrEqual(sampleX, Vector<float>.Zero) & Vector.LessThan(sampleX, width), weight, Vector<float>.Zero);
+                        }
+
+                        redSum += sampleRed * weight;
+                        greenSum += sampleGreen * weight;
+                        blueSum += sampleBlue * weight;
+                        weightSum += weight;
+                    }
+                }
+
+                // The center tap of the pixels of the image always has a weight, the lanes in
+                // the padding are kept at zero
+                var isInImage = Vector.LessThan(_laneOffsets + new Vector<float>(x), width);
+                var inverseWeightSum = Vector.ConditionalSelect(isInImage, Vector<float>.One / weightSum, Vector<float>.Zero);
+                var outputIndex = layout.GetIndex(outputPlane, x, y);
+
+                (redSum * inverseWeightSum).CopyTo(planes, outputIndex);
+                (greenSum * inverseWeightSum).CopyTo(planes, outputIndex + planeLength);
+                (blueSum * inverseWeightSum).CopyTo(planes, outputIndex + planeLength * 2);
+            }
+        }
+    }
+
+    private static Vector<float> Square(Vector<float> value)
+    {
+        return value * value;
+    }
+
+    // NOTE: e^-x for positive values, 2^-f is approximated with a polynomial on the fraction
+    // of x * log2(e) and the integer part goes in the exponent bits. The relative error is
+    // below 1e-5 which is plenty for weights. Results stop at 2^-60 so the weighted colors
+    // never become denormals, which are very slow.
+    private static Vector<float> ExpNegative(Vector<float> value)
+    {
+        var exponent = Vector.Min(value * 1.442695f, new Vector<float>(60.0f));
+        var integerPart = Vector.ConvertToInt32(exponent);
+        var fraction = exponent - Vector.ConvertToSingle(integerPart);
+
+        var polynomial = new Vector<float>(0.006841991f);
+        polynomial = polynomial * fraction + new Vector<float>(-0.05322683f);
+        polynomial = polynomial * fraction + new Vector<float>(0.23943921f);
+        polynomial = polynomial * fraction + new Vector<float>(-0.69305067f);
+        polynomial = polynomial * fraction + new Vector<float>(0.99999809f);
+
+        return polynomial * Vector.AsVectorSingle(Vector.ShiftLeft(new Vector<int>(127) - integerPart, 23));
+    }
+
+    private static Vector<float> CreateLaneOffsets()
+    {
+        Span<float> offsets = stackalloc float[Vector<float>.Count];
+
+        for (var i = 0; i < offsets.Length; i++)
+        {
+            offsets[i] = i;
+        }
+
+        return new Vector<float>(offsets);
+    }
+
+    private T[] Rent<T>(int length) where T : unmanaged
+    {
+        return _bufferPool is not null ? _bufferPool.Rent<T>(length) : new T[length];
+    }
+
+    private void Return<T>(T[] array) where T : unmanaged
+    {
+        _bufferPool?.Return(array);
+    }
+
+    // NOTE: Rows are padded on both sides by the farthest tap of a vector and one vector
+    private readonly record struct PlaneLayout
+    {
+        public const int FirstColorPlane = 0;
+        public const int SecondColorPlane = 3;
+        public const int AlbedoPlane = 6;
+        public const int NormalPlane = 9;
+        public const int DepthPlane = 12;
+
+        public PlaneLayout(int width, int height)
+        {
+            Width = width;
+            Height = height;
+            Padding = 2 * (1 << (PassCount - 1)) + Vector<float>.Count;
+            RowStride = width + Padding * 2;
+            PlaneLength = RowStride * height;
+        }
+
+        public int Width { get; }
+        public int Height { get; }
+        public int Padding { get; }
+        public int RowStride { get; }
+        public int PlaneLength { get; }
+
+        public int GetIndex(int plane, int x, int y)
+        {
+            return plane * PlaneLength + y * RowStride + Padding + x;
+        }
+    }
+
+    private sealed class ResolveRows
+    {
+        public ResolveRows(int width)
+        {
+            Colors = new Vector4[width];
+            Features = new PixelFeatures[width];
+        }
+
+        public Vector4[] Colors { get; }
+        public PixelFeatures[] Features { get; }
+    }
+}
\ No newline at end of file
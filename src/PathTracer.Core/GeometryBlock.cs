@@ -0,0 +1,22 @@
+namespace PathTracer.Core;
+
+// NOTE: Spheres shared by every instance that references the block, positions are in the
+// space of the block. The block hierarchy is built once and used by all of its instances
+// so the memory of a scene grows with the number of blocks, not the number of instances.
+// Spheres of a block in a scene are edited with Scene.UpdateGeometrySphere so the block
+// hierarchy and the top level hierarchy are built again.
+public class GeometryBlock
+{
+    public GeometryBlock() : this(new List<Sphere>())
+    {
+    }
+
+    public GeometryBlock(IList<Sphere> spheres)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+        Spheres = spheres;
+    }
+
+    public IList<Sphere> Spheres { get; }
+    public BoundingVolumeHierarchy? AccelerationStructure { get; set; }
+}
\ No newline at end of file
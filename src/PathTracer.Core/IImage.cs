@@ -4,4 +4,5 @@ public interface IImage
 {
     public int Width { get; init; }
     public int Height { get; init; }
-}
\ No newline at end of file
+    public AccumulationBuffer AccumulationBuffer { get; }
+}
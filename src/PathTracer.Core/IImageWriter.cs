@@ -2,6 +2,5 @@ namespace PathTracer.Core;
 
 public interface IImageWriter<T, TParameter> where T : IImage
 {
-    void StorePixel(T image, int x, int y, Vector4 pixel);
     void CommitImage(T image, TParameter parameter);
-}
\ No newline at end of file
+}
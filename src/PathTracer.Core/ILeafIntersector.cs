@@ -0,0 +1,7 @@
+namespace PathTracer.Core;
+
+// NOTE: Tests the primitives of a hierarchy leaf, hitDistance is lowered when a closer hit is found
+internal interface ILeafIntersector
+{
+    void Intersect(Ray ray, int firstIndex, int count, ref float hitDistance);
+}
\ No newline at end of file
@@ -2,5 +2,8 @@ namespace PathTracer.Core;
 
 public interface IRandomGenerator
 {
-    Vector3 GetVector3();
+    RandomState CreateState(int pixelIndex, int sampleIndex);
+
+    // NOTE: Returns a vector in the [-0.5, 0.5) range
+    Vector3 GetVector3(ref RandomState state);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@ namespace PathTracer.Core;
 
 public interface IRenderer<TImage, TParameter> where TImage : IImage
 {
-    void Render(TImage image, Scene scene, Camera camera);
+    RenderCounters Counters { get; }
+
+    void Render(TImage image, Scene scene, Camera camera, RenderOptions renderOptions, CancellationToken cancellationToken);
     void CommitImage(TImage image, TParameter parameter);
 }
\ No newline at end of file
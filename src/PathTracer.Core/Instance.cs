@@ -0,0 +1,21 @@
+namespace PathTracer.Core;
+
+// NOTE: Places a geometry block in the scene. The transform is applied to the whole block
+// so it keeps its shape, scale is uniform because spheres must stay spheres. The material
+// overrides the materials of the block spheres when it is not negative.
+public record struct Instance
+{
+    public Instance()
+    {
+        Rotation = Quaternion.Identity;
+        Scale = 1.0f;
+        MaterialIndex = -1;
+    }
+
+    public int GeometryIndex { get; set; }
+    public Vector3 Position { get; set; }
+    public Quaternion Rotation { get; set; }
+    public float Scale { get; set; }
+
+    public int MaterialIndex { get; set; }
+}
\ No newline at end of file
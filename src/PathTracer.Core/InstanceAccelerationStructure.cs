@@ -0,0 +1,230 @@
+using System.Runtime.CompilerServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Top level of the two level acceleration structure. The hierarchy is built over the
+// bounds of the instances and its leaves transform the ray into the space of the block
+// before intersecting the block hierarchy, which is shared by every instance of the block.
+// Instances only cost their transform and their share of the nodes. Editing instances
+// builds a new top level, the block hierarchies are kept.
+public class InstanceAccelerationStructure
+{
+    private const int MaxLeafInstanceCount = 4;
+
+    private readonly BoundingVolumeHierarchyNode[] _nodes;
+    private readonly InstanceTransform[] _transforms;
+    private readonly BoundingVolumeHierarchy[] _geometries;
+
+    private InstanceAccelerationStructure(BoundingVolumeHierarchyNode[] nodes, int maxDepth, InstanceTransform[] transforms, BoundingVolumeHierarchy[] geometries)
+    {
+        _nodes = nodes;
+        _transforms = transforms;
+        _geometries = geometries;
+
+        MaxDepth = maxDepth;
+    }
+
+    public int InstanceCount => _transforms.Length;
+    public int NodeCount => _nodes.Length;
+    public int MaxDepth { get; }
+    public ReadOnlySpan<BoundingVolumeHierarchyNode> Nodes => _nodes;
+
+    // NOTE: Blocks without an acceleration structure get a temporary one, commit the scene
+    // changes first so the block hierarchies are built once
+    public static InstanceAccelerationStructure Build(IList<GeometryBlock> geometries, IList<Instance> instances)
+    {
+        ArgumentNullException.ThrowIfNull(geometries);
+        ArgumentNullException.ThrowIfNull(instances);
+
+        var geometryHierarchies = new BoundingVolumeHierarchy[geometries.Count];
+
+        for (var i = 0; i < geometryHierarchies.Length; i++)
+        {
+            geometryHierarchies[i] = geometries[i].AccelerationStructure ?? BoundingVolumeHierarchy.Build(geometries[i].Spheres);
+        }
+
+        var instanceBounds = new BoundingBox[instances.Count];
+
+        for (var i = 0; i < instanceBounds.Length; i++)
+        {
+            var instance = instances[i];
+
+            if (instance.GeometryIndex < 0 || instance.GeometryIndex >= geometryHierarchies.Length)
+            {
+                throw new ArgumentException($"Instance {i} references geometry {instance.GeometryIndex} outside of the {geometryHierarchies.Length} geometries.", nameof(instances));
+            }
+
+            if (!(instance.Scale > 0.0f) || instance.Rotation.LengthSquared() == 0.0f)
+            {
+                throw new ArgumentException($"Instance {i} must have a positive scale and a valid rotation.", nameof(instances));
+            }
+
+            instanceBounds[i] = TransformBounds(geometryHierarchies[instance.GeometryIndex].Bounds, instance);
+        }
+
+        var nodes = BoundingVolumeHierarchy.BuildNodes(instanceBounds, MaxLeafInstanceCount, 1, out var instanceIndices, out var nodeCount, out var maxDepth);
+
+        // Store the transforms in the traversal order so leaves read contiguous memory
+        var transforms = new InstanceTransform[instanceIndices.Length];
+
+        for (var i = 0; i < transforms.Length; i++)
+        {
+            var instance = instances[instanceIndices[i]];
+
+            transforms[i] = new InstanceTransform
+            {
+                Position = instance.Position,
+                InverseRotation = Quaternion.Conjugate(Quaternion.Normalize(instance.Rotation)),
+                InverseScale = 1.0f / instance.Scale,
+                GeometryIndex = instance.GeometryIndex,
+                InstanceIndex = instanceIndices[i]
+            };
+        }
+
+        // NOTE: The builder allocates the worst case node count, leaves hold several instances
+        // so most of it is unused
+        return new InstanceAccelerationStructure(nodes.AsSpan(0, nodeCount).ToArray(), maxDepth, transforms, geometryHierarchies);
+    }
+
+    public bool Intersect(Ray ray, out float hitDistance, out int instanceIndex, out int objectIndex)
+    {
+        var intersectionTestCount = 0L;
+
+        hitDistance = float.MaxValue;
+        instanceIndex = -1;
+        objectIndex = -1;
+
+        return IntersectClosest(ray, ref hitDistance, ref instanceIndex, ref objectIndex, ref intersectionTestCount);
+    }
+
+    // NOTE: Same contract as BoundingVolumeHierarchy.IntersectClosest, objectIndex is the
+    // index of the sphere in the block of the instance
+    public bool IntersectClosest(Ray ray, ref float hitDistance, ref int instanceIndex, ref int objectIndex, ref long intersectionTestCount)
+    {
+        var leafIntersector = new InstanceLeafIntersector(_transforms, _geometries, instanceIndex, objectIndex);
+        var isHit = BoundingVolumeHierarchy.Traverse(_nodes, MaxDepth, ray, ref hitDistance, ref leafIntersector);
+
+        instanceIndex = leafIntersector.InstanceIndex;
+        objectIndex = leafIntersector.ObjectIndex;
+        intersectionTestCount += leafIntersector.IntersectionTestCount;
+
+        return isHit;
+    }
+
+    // NOTE: Same contract as BoundingVolumeHierarchy.IntersectAny
+    public bool IntersectAny(Ray ray, ref float hitDistance, ref long intersectionTestCount)
+    {
+        var leafIntersector = new InstanceAnyHitLeafIntersector(_transforms, _geometries);
+        var isHit = BoundingVolumeHierarchy.TraverseAny(_nodes, MaxDepth, ray, ref hitDistance, ref leafIntersector);
+
+        intersectionTestCount += leafIntersector.IntersectionTestCount;
+
+        return isHit;
+    }
+
+    // NOTE: The ray direction is scaled with the block so hit distances are the same in
+    // both spaces and can be compared with the hits of the other instances
+    private static Ray TransformRay(Ray ray, in InstanceTransform transform)
+    {
+        return new Ray
+        {
+            Origin = Vector3.Transform(ray.Origin - transform.Position, transform.InverseRotation) * transform.InverseScale,
+            Direction = Vector3.Transform(ray.Direction, transform.InverseRotation) * transform.InverseScale
+        };
+    }
+
+    private static BoundingBox TransformBounds(BoundingBox bounds, Instance instance)
+    {
+        if (bounds.IsEmpty)
+        {
+            return bounds;
+        }
+
+        var rotation = Quaternion.Normalize(instance.Rotation);
+        var result = new BoundingBox();
+
+        for (var i = 0; i < 8; i++)
+        {
+            var corner = new Vector3((i & 1) == 0 ? bounds.Min.X : bounds.Max.X,
+                                     (i & 2) == 0 ? bounds.Min.Y : bounds.Max.Y,
+                                     (i & 4) == 0 ? bounds.Min.Z : bounds.Max.Z);
+
+            result = result.Union(instance.Position + Vector3.Transform(corner * instance.Scale, rotation));
+        }
+
+        return result;
+    }
+
+    private readonly record struct InstanceTransform
+    {
+        public Quaternion InverseRotation { get; init; }
+        public Vector3 Position { get; init; }
+        public float InverseScale { get; init; }
+        public int GeometryIndex { get; init; }
+        public int InstanceIndex { get; init; }
+    }
+
+    private struct InstanceLeafIntersector : ILeafIntersector
+    {
+        private readonly InstanceTransform[] _transforms;
+        private readonly BoundingVolumeHierarchy[] _geometries;
+        private int _instanceIndex;
+        private int _objectIndex;
+        private long _intersectionTestCount;
+
+        public InstanceLeafIntersector(InstanceTransform[] transforms, BoundingVolumeHierarchy[] geometries, int instanceIndex, int objectIndex)
+        {
+            _transforms = transforms;
+            _geometries = geometries;
+            _instanceIndex = instanceIndex;
+            _objectIndex = objectIndex;
+        }
+
+        public readonly int InstanceIndex => _instanceIndex;
+        public readonly int ObjectIndex => _objectIndex;
+        public readonly long IntersectionTestCount => _intersectionTestCount;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public void Intersect(Ray ray, int firstIndex, int count, ref float hitDistance)
+        {
+            for (var i = firstIndex; i < firstIndex + count; i++)
+            {
+                ref readonly var transform = ref _transforms[i];
+
+                if (_geometries[transform.GeometryIndex].IntersectClosest(TransformRay(ray, transform), ref hitDistance, ref _objectIndex, ref _intersectionTestCount))
+                {
+                    _instanceIndex = transform.InstanceIndex;
+                }
+            }
+        }
+    }
+
+    private struct InstanceAnyHitLeafIntersector : ILeafIntersector
+    {
+        private readonly InstanceTransform[] _transforms;
+        private readonly BoundingVolumeHierarchy[] _geometries;
+        private long _intersectionTestCount;
+
+        public InstanceAnyHitLeafIntersector(InstanceTransform[] transforms, BoundingVolumeHierarchy[] geometries)
+        {
+            _transforms = transforms;
+            _geometries = geometries;
+        }
+
+        public readonly long IntersectionTestCount => _intersectionTestCount;
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        public void Intersect(Ray ray, int firstIndex, int count, ref float hitDistance)
+        {
+            for (var i = firstIndex; i < firstIndex + count; i++)
+            {
+                ref readonly var transform = ref _transforms[i];
+
+                if (_geometries[transform.GeometryIndex].IntersectAny(TransformRay(ray, transform), ref hitDistance, ref _intersectionTestCount))
+                {
+                    return;
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
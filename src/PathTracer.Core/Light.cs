@@ -0,0 +1,23 @@
+namespace PathTracer.Core;
+
+// NOTE: Lights are not part of the geometry, they are only reached by the shadow rays of the
+// next event estimation. Directional lights shine along Direction from an infinite distance,
+// point lights shine from Position and fall off with the square of the distance. A point
+// light with a radius is sampled at a random point of its sphere so its shadows are soft.
+public record struct Light
+{
+    public Light()
+    {
+        Type = LightType.Directional;
+        Direction = new Vector3(0.0f, -1.0f, 0.0f);
+        Color = Vector3.One;
+        Intensity = 1.0f;
+    }
+
+    public LightType Type { get; set; }
+    public Vector3 Position { get; set; }
+    public Vector3 Direction { get; set; }
+    public Vector3 Color { get; set; }
+    public float Intensity { get; set; }
+    public float Radius { get; set; }
+}
\ No newline at end of file
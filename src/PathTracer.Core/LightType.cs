@@ -0,0 +1,7 @@
+namespace PathTracer.Core;
+
+public enum LightType
+{
+    Directional,
+    Point
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+namespace PathTracer.Core;
+
+// NOTE: Uses the R3 additive recurrence (x_n = frac(x_0 + n * alpha)) over the sample index,
+// see https://extremelearning.com.au/unreasonable-effectiveness-of-quasirandom-sequences.
+// Each pixel and dimension gets its own random rotation so neighbouring pixels are not
+// correlated while successive samples of a pixel stay well distributed.
+public class LowDiscrepancyRandomGenerator : IRandomGenerator
+{
+    // NOTE: Alpha values are the inverse powers of the plastic number generalization for 3 dimensions
+    private const double Alpha1 = 0.8191725133961645;
+    private const double Alpha2 = 0.6710436067037893;
+    private const double Alpha3 = 0.5497004779019703;
+
+    public RandomState CreateState(int pixelIndex, int sampleIndex)
+    {
+        return new RandomState(pixelIndex, sampleIndex);
+    }
+
+    public Vector3 GetVector3(ref RandomState state)
+    {
+        var dimension = state.NextDimension();
+        var rotation = new Pcg32(Pcg32.MixBits((ulong)(uint)state.PixelIndex), (uint)dimension);
+
+        var x = Fraction(rotation.NextSingle() + state.SampleIndex * Alpha1);
+        var y = Fraction(rotation.NextSingle() + state.SampleIndex * Alpha2);
+        var z = Fraction(rotation.NextSingle() + state.SampleIndex * Alpha3);
+
+        return new Vector3(x - 0.5f, y - 0.5f, z - 0.5f);
+    }
+
+    private static float Fraction(double value)
+    {
+        // Keep the result below 1 when the rounding to float goes up
+        return MathF.Min((float)(value - Math.Floor(value)), 0.99999994f);
+    }
+}
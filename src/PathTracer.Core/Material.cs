@@ -1,5 +1,7 @@
 namespace PathTracer.Core;
 
+// NOTE: Parameters of the Bsdf. Emission is the radiance leaving the surface, emissive
+// spheres are only found by the bounces, the shadow rays only sample the scene lights.
 public record struct Material
 {
     public Material()
@@ -12,4 +14,5 @@ public record struct Material
     public Vector3 Albedo { get; set; }
     public float Roughness { get; set; }
     public float Metallic { get; set; }
+    public Vector3 Emission { get; set; }
 }
\ No newline at end of file
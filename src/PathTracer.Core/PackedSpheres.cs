@@ -0,0 +1,328 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Intrinsics;
+
+namespace PathTracer.Core;
+
+// NOTE: Structure of arrays representation of the spheres used by the intersection kernels.
+// The arrays are padded with spheres that can never be hit so the SIMD kernels can read
+// full vectors past the end of a range without bound checks.
+public class PackedSpheres
+{
+    private const int Padding = 16;
+    private const int MinimumVectorizedCount = 4;
+
+    private readonly float[] _positionsX;
+    private readonly float[] _positionsY;
+    private readonly float[] _positionsZ;
+    private readonly float[] _radiiSquared;
+    private readonly int[] _objectIndices;
+
+    private PackedSpheres(int count)
+    {
+        Count = count;
+
+        _positionsX = new float[count + Padding];
+        _positionsY = new float[count + Padding];
+        _positionsZ = new float[count + Padding];
+        _radiiSquared = new float[count + Padding];
+        _objectIndices = new int[count + Padding];
+
+        // A negative infinite squared radius always gives a negative discriminant
+        _radiiSquared.AsSpan(count).Fill(float.NegativeInfinity);
+        _objectIndices.AsSpan(count).Fill(-1);
+    }
+
+    public static int LaneCount { get; } = Vector512.IsHardwareAccelerated ? Vector512<float>.Count :
+                                           Vector256.IsHardwareAccelerated ? Vector256<float>.Count :
+                                           Vector128.IsHardwareAccelerated ? Vector128<float>.Count : 1;
+
+    public int Count { get; }
+    public ReadOnlySpan<float> PositionsX => _positionsX.AsSpan(0, Count);
+    public ReadOnlySpan<float> PositionsY => _positionsY.AsSpan(0, Count);
+    public ReadOnlySpan<float> PositionsZ => _positionsZ.AsSpan(0, Count);
+    public ReadOnlySpan<float> RadiiSquared => _radiiSquared.AsSpan(0, Count);
+    public ReadOnlySpan<int> ObjectIndices => _objectIndices.AsSpan(0, Count);
+
+    public static PackedSpheres Create(Scene scene)
+    {
+        ArgumentNullException.ThrowIfNull(scene);
+
+        var objectIndices = new int[scene.Spheres.Count];
+
+        for (var i = 0; i < objectIndices.Length; i++)
+        {
+            objectIndices[i] = i;
+        }
+
+        return Create(scene.Spheres, objectIndices);
+    }
+
+    public static PackedSpheres Create(IList<Sphere> spheres, ReadOnlySpan<int> objectIndices)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+
+        var packedSpheres = new PackedSpheres(objectIndices.Length);
+
+        for (var i = 0; i < objectIndices.Length; i++)
+        {
+            var sphere = spheres[objectIndices[i]];
+
+            packedSpheres._positionsX[i] = sphere.Position.X;
+            packedSpheres._positionsY[i] = sphere.Position.Y;
+            packedSpheres._positionsZ[i] = sphere.Position.Z;
+            packedSpheres._radiiSquared[i] = sphere.Radius * sphere.Radius;
+            packedSpheres._objectIndices[i] = objectIndices[i];
+        }
+
+        return packedSpheres;
+    }
+
+    public PackedSpheres Clone()
+    {
+        var packedSpheres = new PackedSpheres(Count);
+
+        _positionsX.CopyTo(packedSpheres._positionsX, 0);
+        _positionsY.CopyTo(packedSpheres._positionsY, 0);
+        _positionsZ.CopyTo(packedSpheres._positionsZ, 0);
+        _radiiSquared.CopyTo(packedSpheres._radiiSquared, 0);
+        _objectIndices.CopyTo(packedSpheres._objectIndices, 0);
+
+        return packedSpheres;
+    }
+
+    // NOTE: Updates the geometry of a packed sphere in place, the object index doesn't change
+    public void Update(int index, Sphere sphere)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(index);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(index, Count);
+
+        _positionsX[index] = sphere.Position.X;
+        _positionsY[index] = sphere.Position.Y;
+        _positionsZ[index] = sphere.Position.Z;
+        _radiiSquared[index] = sphere.Radius * sphere.Radius;
+    }
+
+    public bool Intersect(Ray ray, out float hitDistance, out int objectIndex)
+    {
+        hitDistance = float.MaxValue;
+        objectIndex = -1;
+
+        Intersect(ray, 0, Count, ref hitDistance, ref objectIndex);
+        return objectIndex != -1;
+    }
+
+    // NOTE: The SIMD kernels process whole vectors so they may also test the spheres that follow
+    // the range. Those are real spheres (or padding) so the closest hit stays correct.
+    public void Intersect(Ray ray, int firstIndex, int count, ref float hitDistance, ref int objectIndex)
+    {
+        if (count < MinimumVectorizedCount)
+        {
+            IntersectScalar(ray, firstIndex, count, ref hitDistance, ref objectIndex);
+        }
+        else if (Vector512.IsHardwareAccelerated)
+        {
+            IntersectVector512(ray, firstIndex, count, ref hitDistance, ref objectIndex);
+        }
+        else if (Vector256.IsHardwareAccelerated)
+        {
+            IntersectVector256(ray, firstIndex, count, ref hitDistance, ref objectIndex);
+        }
+        else if (Vector128.IsHardwareAccelerated)
+        {
+            IntersectVector128(ray, firstIndex, count, ref hitDistance, ref objectIndex);
+        }
+        else
+        {
+            IntersectScalar(ray, firstIndex, count, ref hitDistance, ref objectIndex);
+        }
+    }
+
+    public void IntersectScalar(Ray ray, int firstIndex, int count, ref float hitDistance, ref int objectIndex)
+    {
+        var direction = ray.Direction;
+        var a = direction.X * direction.X + direction.Y * direction.Y + direction.Z * direction.Z;
+
+        for (var i = firstIndex; i < firstIndex + count; i++)
+        {
+            var originX = ray.Origin.X - _positionsX[i];
+            var originY = ray.Origin.Y - _positionsY[i];
+            var originZ = ray.Origin.Z - _positionsZ[i];
+
+            // Construct quadratic function components
+            var b = 2.0f * (originX * direction.X + originY * direction.Y + originZ * direction.Z);
+            var c = originX * originX + originY * originY + originZ * originZ - _radiiSquared[i];
+
+            // Solve quadratic function
+            var discriminant = b * b - 4.0f * a * c;
+
+            if (discriminant < 0.0f)
+            {
+                continue;
+            }
+
+            var t = (-b + -MathF.Sqrt(discriminant)) / (2.0f * a);
+
+            if (t > 0 && t < hitDistance)
+            {
+                hitDistance = t;
+                objectIndex = _objectIndices[i];
+            }
+        }
+    }
+
+    private void IntersectVector512(Ray ray, int firstIndex, int count, ref float hitDistance, ref int objectIndex)
+    {
+        var direction = ray.Direction;
+        var a = direction.X * direction.X + direction.Y * direction.Y + direction.Z * direction.Z;
+
+        var rayOriginX = Vector512.Create(ray.Origin.X);
+        var rayOriginY = Vector512.Create(ray.Origin.Y);
+        var rayOriginZ = Vector512.Create(ray.Origin.Z);
+        var directionX = Vector512.Create(direction.X);
+        var directionY = Vector512.Create(direction.Y);
+        var directionZ = Vector512.Create(direction.Z);
+        var fourA = Vector512.Create(4.0f * a);
+        var twoA = Vector512.Create(2.0f * a);
+
+        for (var i = firstIndex; i < firstIndex + count; i += Vector512<float>.Count)
+        {
+            var originX = rayOriginX - Vector512.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsX), (nuint)i);
+            var originY = rayOriginY - Vector512.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsY), (nuint)i);
+            var originZ = rayOriginZ - Vector512.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsZ), (nuint)i);
+            var radiusSquared = Vector512.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_radiiSquared), (nuint)i);
+
+            var b = Vector512.Create(2.0f) * (originX * directionX + originY * directionY + originZ * directionZ);
+            var c = originX * originX + originY * originY + originZ * originZ - radiusSquared;
+            var discriminant = b * b - fourA * c;
+
+            var t = (-b + -Vector512.Sqrt(discriminant)) / twoA;
+            var mask = Vector512.GreaterThanOrEqual(discriminant, Vector512<float>.Zero) &
+                       Vector512.GreaterThan(t, Vector512<float>.Zero) &
+                       Vector512.LessThan(t, Vector512.Create(hitDistance));
+
+            if (mask != Vector512<float>.Zero)
+            {
+                var candidates = Vector512.ConditionalSelect(mask, t, Vector512.Create(float.MaxValue));
+                SelectClosestLane(candidates.GetLower(), candidates.GetUpper(), i, ref hitDistance, ref objectIndex);
+            }
+        }
+    }
+
+    private void IntersectVector256(Ray ray, int firstIndex, int count, ref float hitDistance, ref int objectIndex)
+    {
+        var direction = ray.Direction;
+        var a = direction.X * direction.X + direction.Y * direction.Y + direction.Z * direction.Z;
+
+        var rayOriginX = Vector256.Create(ray.Origin.X);
+        var rayOriginY = Vector256.Create(ray.Origin.Y);
+        var rayOriginZ = Vector256.Create(ray.Origin.Z);
+        var directionX = Vector256.Create(direction.X);
+        var directionY = Vector256.Create(direction.Y);
+        var directionZ = Vector256.Create(direction.Z);
+        var fourA = Vector256.Create(4.0f * a);
+        var twoA = Vector256.Create(2.0f * a);
+
+        for (var i = firstIndex; i < firstIndex + count; i += Vector256<float>.Count)
+        {
+            var originX = rayOriginX - Vector256.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsX), (nuint)i);
+            var originY = rayOriginY - Vector256.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsY), (nuint)i);
+            var originZ = rayOriginZ - Vector256.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsZ), (nuint)i);
+            var radiusSquared = Vector256.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_radiiSquared), (nuint)i);
+
+            var b = Vector256.Create(2.0f) * (originX * directionX + originY * directionY + originZ * directionZ);
+            var c = originX * originX + originY * originY + originZ * originZ - radiusSquared;
+            var discriminant = b * b - fourA * c;
+
+            var t = (-b + -Vector256.Sqrt(discriminant)) / twoA;
+            var mask = Vector256.GreaterThanOrEqual(discriminant, Vector256<float>.Zero) &
+                       Vector256.GreaterThan(t, Vector256<float>.Zero) &
+                       Vector256.LessThan(t, Vector256.Create(hitDistance));
+
+            if (mask != Vector256<float>.Zero)
+            {
+                var candidates = Vector256.ConditionalSelect(mask, t, Vector256.Create(float.MaxValue));
+                SelectClosestLane(candidates, i, ref hitDistance, ref objectIndex);
+            }
+        }
+    }
+
+    private void IntersectVector128(Ray ray, int firstIndex, int count, ref float hitDistance, ref int objectIndex)
+    {
+        var direction = ray.Direction;
+        var a = direction.X * direction.X + direction.Y * direction.Y + direction.Z * direction.Z;
+
+        var rayOriginX = Vector128.Create(ray.Origin.X);
+        var rayOriginY = Vector128.Create(ray.Origin.Y);
+        var rayOriginZ = Vector128.Create(ray.Origin.Z);
+        var directionX = Vector128.Create(direction.X);
+        var directionY = Vector128.Create(direction.Y);
+        var directionZ = Vector128.Create(direction.Z);
+        var fourA = Vector128.Create(4.0f * a);
+        var twoA = Vector128.Create(2.0f * a);
+
+        for (var i = firstIndex; i < firstIndex + count; i += Vector128<float>.Count)
+        {
+            var originX = rayOriginX - Vector128.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsX), (nuint)i);
+            var originY = rayOriginY - Vector128.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsY), (nuint)i);
+            var originZ = rayOriginZ - Vector128.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_positionsZ), (nuint)i);
+            var radiusSquared = Vector128.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(_radiiSquared), (nuint)i);
+
+            var b = Vector128.Create(2.0f) * (originX * directionX + originY * directionY + originZ * directionZ);
+            var c = originX * originX + originY * originY + originZ * originZ - radiusSquared;
+            var discriminant = b * b - fourA * c;
+
+            var t = (-b + -Vector128.Sqrt(discriminant)) / twoA;
+            var mask = Vector128.GreaterThanOrEqual(discriminant, Vector128<float>.Zero) &
+                       Vector128.GreaterThan(t, Vector128<float>.Zero) &
+                       Vector128.LessThan(t, Vector128.Create(hitDistance));
+
+            if (mask != Vector128<float>.Zero)
+            {
+                var candidates = Vector128.ConditionalSelect(mask, t, Vector128.Create(float.MaxValue));
+                SelectClosestLane(candidates, i, ref hitDistance, ref objectIndex);
+            }
+        }
+    }
+
+    private void SelectClosestLane(Vector256<float> lower, Vector256<float> upper, int firstIndex, ref float hitDistance, ref int objectIndex)
+    {
+        SelectClosestLane(lower, firstIndex, ref hitDistance, ref objectIndex);
+        SelectClosestLane(upper, firstIndex + Vector256<float>.Count, ref hitDistance, ref objectIndex);
+    }
+
+    private void SelectClosestLane(Vector256<float> candidates, int firstIndex, ref float hitDistance, ref int objectIndex)
+    {
+        var closestDistance = HorizontalMinimum(Vector128.Min(candidates.GetLower(), candidates.GetUpper()));
+
+        if (closestDistance < hitDistance)
+        {
+            var laneMask = Vector256.Equals(candidates, Vector256.Create(closestDistance)).ExtractMostSignificantBits();
+
+            hitDistance = closestDistance;
+            objectIndex = _objectIndices[firstIndex + BitOperations.TrailingZeroCount(laneMask)];
+        }
+    }
+
+    private void SelectClosestLane(Vector128<float> candidates, int firstIndex, ref float hitDistance, ref int objectIndex)
+    {
+        var closestDistance = HorizontalMinimum(candidates);
+
+        if (closestDistance < hitDistance)
+        {
+            var laneMask = Vector128.Equals(candidates, Vector128.Create(closestDistance)).ExtractMostSignificantBits();
+
+            hitDistance = closestDistance;
+            objectIndex = _objectIndices[firstIndex + BitOperations.TrailingZeroCount(laneMask)];
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static float HorizontalMinimum(Vector128<float> value)
+    {
+        value = Vector128.Min(value, Vector128.Shuffle(value, Vector128.Create(2, 3, 0, 1)));
+        value = Vector128.Min(value, Vector128.Shuffle(value, Vector128.Create(1, 0, 3, 2)));
+
+        return value.ToScalar();
+    }
+}
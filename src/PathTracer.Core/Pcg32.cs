@@ -0,0 +1,47 @@
+namespace PathTracer.Core;
+
+// NOTE: PCG-XSH-RR generator with 64 bits of state, see https://www.pcg-random.org. It is a
+// mutable struct so it must be passed by ref, copying it duplicates the random stream.
+public record struct Pcg32
+{
+    private const ulong Multiplier = 6364136223846793005;
+
+    private ulong _state;
+    private readonly ulong _increment;
+
+    public Pcg32(ulong seed, ulong sequence)
+    {
+        _state = 0;
+        _increment = (sequence << 1) | 1;
+
+        NextUInt32();
+        _state += seed;
+        NextUInt32();
+    }
+
+    public uint NextUInt32()
+    {
+        var oldState = _state;
+        _state = oldState * Multiplier + _increment;
+
+        var xorShifted = (uint)(((oldState >> 18) ^ oldState) >> 27);
+        var rotation = (int)(oldState >> 59);
+
+        return BitOperations.RotateRight(xorShifted, rotation);
+    }
+
+    // NOTE: Returns a value in [0, 1) using the 24 high bits so every value is exactly representable
+    public float NextSingle()
+    {
+        return (NextUInt32() >> 8) * (1.0f / (1 << 24));
+    }
+
+    // NOTE: SplitMix64 finalizer, used to turn structured seeds like pixel indices into uncorrelated states
+    public static ulong MixBits(ulong value)
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+        return value ^ (value >> 31);
+    }
+}
@@ -0,0 +1,11 @@
+namespace PathTracer.Core;
+
+// NOTE: Properties of the first surface hit by a primary ray, used to guide the denoiser.
+// Misses have a white albedo, a zero normal and a zero depth. The struct only contains
+// floats so buffers of features can be summed as floats.
+public readonly record struct PixelFeatures
+{
+    public Vector3 Albedo { get; init; }
+    public Vector3 Normal { get; init; }
+    public float Depth { get; init; }
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+using System.Buffers.Binary;
+using System.IO.Compression;
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Minimal PNG encoder that compresses RGBA8 rows as soon as they are written so the
+// whole image never has to be in memory. Rows are written top to bottom with the Sub filter
+// into one zlib stream that is split in IDAT chunks. Pixels are packed like the output of
+// ToneMapping.ResolveToRgba8. The image is only valid once every row was written and the
+// writer is disposed, which also disposes the output stream unless leaveOpen is true.
+public sealed class PngStreamWriter : IDisposable
+{
+    private const int ChunkSize = 64 * 1024;
+
+    private static readonly uint[] _crcTable = CreateCrcTable();
+
+    private readonly ZLibStream _compressionStream;
+    private readonly byte[] _filteredRow;
+    private readonly uint[] _resolvedRow;
+    private int _rowCount;
+    private bool _isDisposed;
+
+    public PngStreamWriter(Stream stream, int width, int height, CompressionLevel compressionLevel = CompressionLevel.Fastest, bool leaveOpen = false)
+    {
+        ArgumentNullException.ThrowIfNull(stream);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(width);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(height);
+
+        Width = width;
+        Height = height;
+
+        _filteredRow = new byte[width * 4 + 1];
+        _resolvedRow = new uint[width];
+
+        ReadOnlySpan<byte> signature = [0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A];
+        stream.Write(signature);
+
+        Span<byte> header = stackalloc byte[13];
+        header.Clear();
+
+        BinaryPrimitives.WriteInt32BigEndian(header, width);
+        BinaryPrimitives.WriteInt32BigEndian(header[4..], height);
+        header[8] = 8; // Bit depth
+        header[9] = 6; // Color type: RGBA
+
+        WriteChunk(stream, "IHDR"u8, header);
+
+        _compressionStream = new ZLibStream(new ImageDataStream(stream, leaveOpen), compressionLevel);
+    }
+
+    public int Width { get; }
+    public int Height { get; }
+    public int RowCount => _rowCount;
+
+    public void WriteRow(ReadOnlySpan<uint> pixels)
+    {
+        ObjectDisposedException.ThrowIf(_isDisposed, this);
+        ArgumentOutOfRangeException.ThrowIfLessThan(pixels.Length, Width, nameof(pixels));
+
+        if (_rowCount == Height)
+        {
+            throw new InvalidOperationException("Every row of the image was already written.");
+        }
+
+        var source = MemoryMarshal.AsBytes(pixels[..Width]);
+        var destination = _filteredRow.AsSpan(1);
+
+        // Sub filter: every byte is stored as the difference with the same channel of the previous pixel
+        _filteredRow[0] = 1;
+        source[..4].CopyTo(destination);
+
+        for (var i = 4; i < source.Length; i++)
+        {
+            destination[i] = (byte)(source[i] - source[i - 4]);
+        }
+
+        _compressionStream.Write(_filteredRow);
+        _rowCount++;
+    }
+
+    // NOTE: The accumulation buffer stores rows bottom to top, so its rows are written in
+    // reverse order. It must have the same width as the image.
+    public void WriteRows(AccumulationBuffer accumulationBuffer, ToneMappingOperator toneMappingOperator)
+    {
+        ArgumentNullException.ThrowIfNull(accumulationBuffer);
+
+        if (accumulationBuffer.Width != Width)
+        {
+            throw new ArgumentOutOfRangeException(nameof(accumulationBuffer), "Accumulation buffer must have the same width as the image.");
+        }
+
+        for (var i = accumulationBuffer.Height - 1; i >= 0; i--)
+        {
+            accumulationBuffer.ResolveRow(i, _resolvedRow, toneMappingOperator);
+            WriteRow(_resolvedRow);
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_isDisposed)
+        {
+            return;
+        }
+
+        _isDisposed = true;
+
+        // Disposing the compression stream writes the last image data chunk and the end chunk
+        _compressionStream.Dispose();
+    }
+
+    private static void WriteChunk(Stream stream, ReadOnlySpan<byte> chunkType, ReadOnlySpan<byte> data)
+    {
+        Span<byte> buffer = stackalloc byte[4];
+
+        BinaryPrimitives.WriteInt32BigEndian(buffer, data.Length);
+        stream.Write(buffer);
+        stream.Write(chunkType);
+        stream.Write(data);
+
+        BinaryPrimitives.WriteUInt32BigEndian(buffer, ~UpdateCrc(UpdateCrc(uint.MaxValue, chunkType), data));
+        stream.Write(buffer);
+    }
+
+    private static uint UpdateCrc(uint crc, ReadOnlySpan<byte> data)
+    {
+        foreach (var value in data)
+        {
+            crc = _crcTable[(crc ^ value) & 0xFF] ^ (crc >> 8);
+        }
+
+        return crc;
+    }
+
+    private static uint[] CreateCrcTable()
+    {
+        var table = new uint[256];
+
+        for (var i = 0u; i < table.Length; i++)
+        {
+            var value = i;
+
+            for (var j = 0; j < 8; j++)
+            {
+                value = (value & 1) != 0 ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+            }
+
+            table[i] = value;
+        }
+
+        return table;
+    }
+
+    // NOTE: Buffers the compressed data and writes it as IDAT chunks of ChunkSize bytes, the
+    // IEND chunk is written when the stream is disposed
+    private sealed class ImageDataStream : Stream
+    {
+        private readonly Stream _stream;
+        private readonly bool _leaveOpen;
+        private readonly byte[] _buffer;
+        private int _bufferLength;
+
+        public ImageDataStream(Stream stream, bool leaveOpen)
+        {
+            _stream = stream;
+            _leaveOpen = leaveOpen;
+            _buffer = new byte[ChunkSize];
+        }
+
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => throw new NotSupportedException();
+
+        public override long Position
+        {
+            get => throw new NotSupportedException();
+            set => throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] buffer, int offset, int count)
+        {
+            Write(buffer.AsSpan(offset, count));
+        }
+
+        public override void Write(ReadOnlySpan<byte> buffer)
+        {
+            while (buffer.Length > 0)
+            {
+                var copyLength = Math.Min(buffer.Length, _buffer.Length - _bufferLength);
+
+                buffer[..copyLength].CopyTo(_buffer.AsSpan(_bufferLength));
+                _bufferLength += copyLength;
+                buffer = buffer[copyLength..];
+
+                if (_bufferLength == _buffer.Length)
+                {
+                    WriteImageDataChunk();
+                }
+            }
+        }
+
+        // NOTE: Chunks are only written when the buffer is full so flushes don't create small chunks
+        public override void Flush()
+        {
+        }
+
+        public override int Read(byte[] buffer, int offset, int count)
+        {
+            throw new NotSupportedException();
+        }
+
+        public override long Seek(long offset, SeekOrigin origin)
+        {
+            throw new NotSupportedException();
+        }
+
+        public override void SetLength(long value)
+        {
+            throw new NotSupportedException();
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+            if (disposing)
+            {
+                if (_bufferLength > 0)
+                {
+                    WriteImageDataChunk();
+                }
+
+                WriteChunk(_stream, "IEND"u8, []);
+
+                if (!_leaveOpen)
+                {
+                    _stream.Dispose();
+                }
+            }
+
+            base.Dispose(disposing);
+        }
+
+        private void WriteImageDataChunk()
+        {
+            WriteChunk(_stream, "IDAT"u8, _buffer.AsSpan(0, _bufferLength));
+            _bufferLength = 0;
+        }
+    }
+}
\ No newline at end of file
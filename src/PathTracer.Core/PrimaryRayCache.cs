@@ -0,0 +1,73 @@
+namespace PathTracer.Core;
+
+// NOTE: Primary rays of an image for one camera. The inverse projection is linear in the pixel
+// coordinates and the inverse view only rotates directions, so the unnormalized direction of
+// any point of the image is the direction of the first pixel plus a multiple of a per pixel
+// delta on each axis. The matrices are only inverted when the cache is created, rays of a
+// row are generated from the direction of the row and sub-pixel jitter is added with the
+// same deltas. Pixels use the same coordinates as RayGenerator: the jitter is in [0, 1) and
+// a zero jitter is the corner of the pixel.
+public sealed class PrimaryRayCache
+{
+    private readonly Vector3 _firstPixelDirection;
+
+    public PrimaryRayCache(Camera camera, int imageWidth, int imageHeight)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(imageWidth);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(imageHeight);
+
+        Camera = camera;
+        ImageWidth = imageWidth;
+        ImageHeight = imageHeight;
+
+        var viewMatrix = MathUtils.CreateLookAtMatrix(camera.Position, camera.Target, new Vector3(0.0f, 1.0f, 0.0f));
+        Matrix4x4.Invert(viewMatrix, out var inverseViewMatrix);
+
+        var projectionMatrix = MathUtils.CreatePerspectiveFieldOfViewMatrix(MathUtils.DegreesToRad(camera.VerticalFov), camera.AspectRatio, camera.NearPlaneDistance);
+        Matrix4x4.Invert(projectionMatrix, out var inverseProjectionMatrix);
+
+        _firstPixelDirection = GetDirection(new Vector2(-1.0f, -1.0f), inverseProjectionMatrix, inverseViewMatrix);
+
+        PixelDeltaX = (GetDirection(new Vector2(1.0f, -1.0f), inverseProjectionMatrix, inverseViewMatrix) - _firstPixelDirection) / imageWidth;
+        PixelDeltaY = (GetDirection(new Vector2(-1.0f, 1.0f), inverseProjectionMatrix, inverseViewMatrix) - _firstPixelDirection) / imageHeight;
+    }
+
+    public Camera Camera { get; }
+    public int ImageWidth { get; }
+    public int ImageHeight { get; }
+    public Vector3 PixelDeltaX { get; }
+    public Vector3 PixelDeltaY { get; }
+
+    public bool Matches(Camera camera, int imageWidth, int imageHeight)
+    {
+        return Camera == camera && ImageWidth == imageWidth && ImageHeight == imageHeight;
+    }
+
+    // NOTE: Unnormalized direction of the corner of the pixel, used as the start of a row
+    public Vector3 GetRowDirection(int x, int y)
+    {
+        return _firstPixelDirection + x * PixelDeltaX + y * PixelDeltaY;
+    }
+
+    // NOTE: Coordinates are not checked, they are only used to offset the directions
+    public Ray GenerateRay(int x, int y, Vector2 jitter)
+    {
+        return GenerateRay(GetRowDirection(0, y), x, jitter);
+    }
+
+    public Ray GenerateRay(Vector3 rowDirection, int offsetX, Vector2 jitter)
+    {
+        return new Ray
+        {
+            Origin = Camera.Position,
+            Direction = Vector3.Normalize(rowDirection + (offsetX + jitter.X) * PixelDeltaX + jitter.Y * PixelDeltaY)
+        };
+    }
+
+    private static Vector3 GetDirection(Vector2 pixelCoordinates, Matrix4x4 inverseProjectionMatrix, Matrix4x4 inverseViewMatrix)
+    {
+        var target = Vector4.Transform(new Vector4(pixelCoordinates.X, pixelCoordinates.Y, 1.0f, 1.0f), inverseProjectionMatrix);
+
+        return Vector3.TransformNormal(new Vector3(target.X, target.Y, target.Z) / target.W, inverseViewMatrix);
+    }
+}
\ No newline at end of file
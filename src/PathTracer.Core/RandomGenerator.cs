@@ -2,17 +2,15 @@ namespace PathTracer.Core;
 
 public class RandomGenerator : IRandomGenerator
 {
-    private readonly ThreadLocal<Random> _random = new ThreadLocal<Random>(() => new Random(GetSeed()));
-
-    public Vector3 GetVector3()
+    public RandomState CreateState(int pixelIndex, int sampleIndex)
     {
-        var randomLocal = _random.Value;
-
-        return new Vector3(randomLocal.NextSingle() - 0.5f, randomLocal.NextSingle() - 0.5f, randomLocal.NextSingle() - 0.5f);
+        return new RandomState(pixelIndex, sampleIndex);
     }
 
-    private static int GetSeed()
+    public Vector3 GetVector3(ref RandomState state)
     {
-        return Environment.TickCount * Environment.CurrentManagedThreadId;
+        state.NextDimension();
+
+        return new Vector3(state.NextSingle() - 0.5f, state.NextSingle() - 0.5f, state.NextSingle() - 0.5f);
     }
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+namespace PathTracer.Core;
+
+// NOTE: Per path sampler state. It is created from the pixel and sample index so the random
+// stream of a pixel does not depend on the thread that renders it. Dimension counts the
+// random vectors already drawn along the path.
+public record struct RandomState
+{
+    private Pcg32 _generator;
+
+    public RandomState(int pixelIndex, int sampleIndex)
+    {
+        PixelIndex = pixelIndex;
+        SampleIndex = sampleIndex;
+        Dimension = 0;
+
+        _generator = new Pcg32(Pcg32.MixBits(((ulong)(uint)sampleIndex << 32) | (uint)pixelIndex), (uint)pixelIndex);
+    }
+
+    public int PixelIndex { get; }
+    public int SampleIndex { get; }
+    public int Dimension { get; private set; }
+
+    public float NextSingle()
+    {
+        return _generator.NextSingle();
+    }
+
+    public int NextDimension()
+    {
+        return Dimension++;
+    }
+}
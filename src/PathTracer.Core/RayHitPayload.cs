@@ -6,4 +6,8 @@ public readonly record struct RayHitPayload
     public Vector3 WorldPosition { get; init; }
     public Vector3 WorldNormal { get; init; }
     public int ObjectIndex { get; init; }
+
+    // NOTE: -1 when the sphere is not part of an instance, ObjectIndex is then a scene sphere
+    public int InstanceIndex { get; init; }
+    public int MaterialIndex { get; init; }
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+using System.Runtime.CompilerServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Pool of the large arrays used by the image and accumulation buffers. Lengths are
+// rounded up to size classes with four steps per power of two. Rent also takes arrays of the
+// next classes so buffers of close sizes are reused while a window is resized, a rented array
+// can then be up to twice the length of the requested size class. Arrays are allocated on the
+// pinned object heap: they never move, are never compacted with the small objects and can
+// be given to native code. Returned arrays are dropped once the retained memory is above
+// the limit so the pool cannot keep every size seen during a resize.
+public sealed class RenderBufferPool
+{
+    private const int MinimumLength = 1024;
+    private const int StepsPerPowerOfTwo = 4;
+    private const int MaxRetainedArrayCount = 4;
+
+    private readonly Dictionary<(Type ElementType, int SizeClass), Stack<Array>> _buckets;
+    private readonly long _maxRetainedByteCount;
+    private long _retainedByteCount;
+
+    public RenderBufferPool(long maxRetainedByteCount)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(maxRetainedByteCount);
+
+        _buckets = [];
+        _maxRetainedByteCount = maxRetainedByteCount;
+    }
+
+    public static RenderBufferPool Shared { get; } = new RenderBufferPool(512L * 1024 * 1024);
+
+    public long RetainedByteCount => Interlocked.Read(ref _retainedByteCount);
+
+    // NOTE: The content of a rented array is undefined, it can be longer than requested
+    public T[] Rent<T>(int minimumLength) where T : unmanaged
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(minimumLength);
+
+        if (minimumLength == 0)
+        {
+            return [];
+        }
+
+        var sizeClass = GetSizeClass(minimumLength);
+
+        lock (_buckets)
+        {
+            for (var i = sizeClass; i <= sizeClass + StepsPerPowerOfTwo; i++)
+            {
+                if (_buckets.TryGetValue((typeof(T), i), out var bucket) && bucket.TryPop(out var array))
+                {
+                    _retainedByteCount -= GetByteCount((T[])array);
+                    return (T[])array;
+                }
+            }
+        }
+
+        return GC.AllocateUninitializedArray<T>(GetLength(sizeClass), pinned: true);
+    }
+
+    public void Return<T>(T[] array) where T : unmanaged
+    {
+        ArgumentNullException.ThrowIfNull(array);
+
+        // Arrays that were not rented from a pool don't have the length of a size class
+        if (array.Length < MinimumLength || GetLength(GetSizeClass(array.Length)) != array.Length)
+        {
+            return;
+        }
+
+        var byteCount = GetByteCount(array);
+
+        lock (_buckets)
+        {
+            if (_retainedByteCount + byteCount > _maxRetainedByteCount)
+            {
+                return;
+            }
+
+            var key = (typeof(T), GetSizeClass(array.Length));
+
+            if (!_buckets.TryGetValue(key, out var bucket))
+            {
+                bucket = new Stack<Array>(MaxRetainedArrayCount);
+                _buckets.Add(key, bucket);
+            }
+
+            if (bucket.Count < MaxRetainedArrayCount)
+            {
+                bucket.Push(array);
+                _retainedByteCount += byteCount;
+            }
+        }
+    }
+
+    public void Clear()
+    {
+        lock (_buckets)
+        {
+            _buckets.Clear();
+            _retainedByteCount = 0;
+        }
+    }
+
+    // NOTE: Size class 4 * k + s has 2^k + s * 2^k / 4 blocks of the minimum length, the small
+    // classes grow by one block
+    private static int GetSizeClass(int length)
+    {
+        var blockCount = (Math.Max(length, MinimumLength) + MinimumLength - 1) / MinimumLength;
+        var powerOfTwo = 31 - int.LeadingZeroCount(blockCount);
+        var stepLength = Math.Max(1, (1 << powerOfTwo) / StepsPerPowerOfTwo);
+        var step = (blockCount - (1 << powerOfTwo) + stepLength - 1) / stepLength;
+
+        return powerOfTwo * StepsPerPowerOfTwo + step;
+    }
+
+    private static int GetLength(int sizeClass)
+    {
+        var (powerOfTwo, step) = Math.DivRem(sizeClass, StepsPerPowerOfTwo);
+        var stepLength = Math.Max(1, (1 << powerOfTwo) / StepsPerPowerOfTwo);
+
+        return ((1 << powerOfTwo) + step * stepLength) * MinimumLength;
+    }
+
+    private static long GetByteCount<T>(T[] array) where T : unmanaged
+    {
+        return (long)array.Length * Unsafe.SizeOf<T>();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+using System.Diagnostics;
+
+namespace PathTracer.Core;
+
+// NOTE: Stage times are in Stopwatch ticks and summed over every worker thread, so they
+// measure the time spent in each stage and not the wall clock time of a frame
+public record struct RenderCounterValues
+{
+    public long RayCount { get; set; }
+    public long SampleCount { get; set; }
+    public long IntersectionTestCount { get; set; }
+    public long HitCount { get; set; }
+    public long MissCount { get; set; }
+
+    // NOTE: Shadow rays of the next event estimation, they are not part of the ray count
+    public long ShadowRayCount { get; set; }
+
+    // NOTE: Paths ended by the Russian roulette before the max bounce count
+    public long RussianRouletteCount { get; set; }
+    public long RenderTicks { get; set; }
+    public long AccumulateTicks { get; set; }
+    public long ConvergenceTicks { get; set; }
+
+    public readonly double BouncesPerPath => SampleCount > 0 ? (double)RayCount / SampleCount : 0.0;
+    public readonly double RussianRouletteRatio => SampleCount > 0 ? (double)RussianRouletteCount / SampleCount : 0.0;
+    public readonly double HitRatio => HitCount + MissCount > 0 ? (double)HitCount / (HitCount + MissCount) : 0.0;
+    public readonly double IntersectionTestsPerRay => RayCount + ShadowRayCount > 0 ? (double)IntersectionTestCount / (RayCount + ShadowRayCount) : 0.0;
+    public readonly TimeSpan RenderTime => Stopwatch.GetElapsedTime(0, RenderTicks);
+    public readonly TimeSpan AccumulateTime => Stopwatch.GetElapsedTime(0, AccumulateTicks);
+    public readonly TimeSpan ConvergenceTime => Stopwatch.GetElapsedTime(0, ConvergenceTicks);
+
+    public readonly RenderCounterValues Subtract(in RenderCounterValues other)
+    {
+        return new RenderCounterValues
+        {
+            RayCount = RayCount - other.RayCount,
+            SampleCount = SampleCount - other.SampleCount,
+            IntersectionTestCount = IntersectionTestCount - other.IntersectionTestCount,
+            HitCount = HitCount - other.HitCount,
+            MissCount = MissCount - other.MissCount,
+            ShadowRayCount = ShadowRayCount - other.ShadowRayCount,
+            RussianRouletteCount = RussianRouletteCount - other.RussianRouletteCount,
+            RenderTicks = RenderTicks - other.RenderTicks,
+            AccumulateTicks = AccumulateTicks - other.AccumulateTicks,
+            ConvergenceTicks = ConvergenceTicks - other.ConvergenceTicks
+        };
+    }
+}
\ No newline at end of file
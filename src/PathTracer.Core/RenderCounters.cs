@@ -0,0 +1,101 @@
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Totals since the renderer was created. Workers count locally and flush once per tile
+// into the slot of the processor they run on, each slot has its own cache lines so the
+// workers don't contend on the counters. Readers sum the slots.
+public class RenderCounters
+{
+    private readonly Slot[] _slots;
+    private readonly int _slotMask;
+
+    public RenderCounters()
+    {
+        _slots = new Slot[(int)BitOperations.RoundUpToPowerOf2((uint)Environment.ProcessorCount)];
+        _slotMask = _slots.Length - 1;
+    }
+
+    public long RayCount => Sum(static (ref Slot slot) => ref slot.RayCount);
+    public long SampleCount => Sum(static (ref Slot slot) => ref slot.SampleCount);
+
+    public void Add(in RenderCounterValues values)
+    {
+        ref var slot = ref _slots[Thread.GetCurrentProcessorId() & _slotMask];
+
+        Interlocked.Add(ref slot.RayCount, values.RayCount);
+        Interlocked.Add(ref slot.SampleCount, values.SampleCount);
+        Interlocked.Add(ref slot.IntersectionTestCount, values.IntersectionTestCount);
+        Interlocked.Add(ref slot.HitCount, values.HitCount);
+        Interlocked.Add(ref slot.MissCount, values.MissCount);
+        Interlocked.Add(ref slot.ShadowRayCount, values.ShadowRayCount);
+        Interlocked.Add(ref slot.RussianRouletteCount, values.RussianRouletteCount);
+        Interlocked.Add(ref slot.RenderTicks, values.RenderTicks);
+        Interlocked.Add(ref slot.AccumulateTicks, values.AccumulateTicks);
+        Interlocked.Add(ref slot.ConvergenceTicks, values.ConvergenceTicks);
+    }
+
+    public RenderCounterValues GetValues()
+    {
+        return new RenderCounterValues
+        {
+            RayCount = RayCount,
+            SampleCount = SampleCount,
+            IntersectionTestCount = Sum(static (ref Slot slot) => ref slot.IntersectionTestCount),
+            HitCount = Sum(static (ref Slot slot) => ref slot.HitCount),
+            MissCount = Sum(static (ref Slot slot) => ref slot.MissCount),
+            ShadowRayCount = Sum(static (ref Slot slot) => ref slot.ShadowRayCount),
+            RussianRouletteCount = Sum(static (ref Slot slot) => ref slot.RussianRouletteCount),
+            RenderTicks = Sum(static (ref Slot slot) => ref slot.RenderTicks),
+            AccumulateTicks = Sum(static (ref Slot slot) => ref slot.AccumulateTicks),
+            ConvergenceTicks = Sum(static (ref Slot slot) => ref slot.ConvergenceTicks)
+        };
+    }
+
+    public void Reset()
+    {
+        for (var i = 0; i < _slots.Length; i++)
+        {
+            Volatile.Write(ref _slots[i].RayCount, 0);
+            Volatile.Write(ref _slots[i].SampleCount, 0);
+            Volatile.Write(ref _slots[i].IntersectionTestCount, 0);
+            Volatile.Write(ref _slots[i].HitCount, 0);
+            Volatile.Write(ref _slots[i].MissCount, 0);
+            Volatile.Write(ref _slots[i].ShadowRayCount, 0);
+            Volatile.Write(ref _slots[i].RussianRouletteCount, 0);
+            Volatile.Write(ref _slots[i].RenderTicks, 0);
+            Volatile.Write(ref _slots[i].AccumulateTicks, 0);
+            Volatile.Write(ref _slots[i].ConvergenceTicks, 0);
+        }
+    }
+
+    private long Sum(SlotField field)
+    {
+        var result = 0L;
+
+        for (var i = 0; i < _slots.Length; i++)
+        {
+            result += Volatile.Read(ref field(ref _slots[i]));
+        }
+
+        return result;
+    }
+
+    private delegate ref long SlotField(ref Slot slot);
+
+    // NOTE: Two cache lines per slot so the adjacent line prefetcher doesn't share them either
+    [StructLayout(LayoutKind.Sequential, Size = 128)]
+    private struct Slot
+    {
+        public long RayCount;
+        public long SampleCount;
+        public long IntersectionTestCount;
+        public long HitCount;
+        public long MissCount;
+        public long ShadowRayCount;
+        public long RussianRouletteCount;
+        public long RenderTicks;
+        public long AccumulateTicks;
+        public long ConvergenceTicks;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+using System.Diagnostics.Metrics;
+
+namespace PathTracer.Core;
+
+// NOTE: Publishes the counters of the registered renderers as .NET metrics, so they can be
+// read with dotnet-counters on machines without UI:
+//
+//     dotnet-counters monitor -n PathTracer.Console --counters PathTracer.Renderer
+//
+// Measurements are tagged with the renderer name and only read when a listener collects them.
+public sealed class RenderMetrics : IDisposable
+{
+    public const string MeterName = "PathTracer.Renderer";
+
+    private readonly Meter _meter;
+    private readonly List<(string Name, RenderCounters Counters)> _renderers;
+
+    public RenderMetrics()
+    {
+        _meter = new Meter(MeterName);
+        _renderers = [];
+
+        _meter.CreateObservableCounter("pathtracer.rays", () => Observe(static values => values.RayCount), "{ray}", "Rays traced.");
+        _meter.CreateObservableCounter("pathtracer.samples", () => Observe(static values => values.SampleCount), "{sample}", "Samples rendered.");
+        _meter.CreateObservableCounter("pathtracer.intersection_tests", () => Observe(static values => values.IntersectionTestCount), "{test}", "Primitive intersection tests.");
+        _meter.CreateObservableCounter("pathtracer.ray_hits", () => Observe(static values => values.HitCount), "{ray}", "Rays that hit a primitive.");
+        _meter.CreateObservableCounter("pathtracer.ray_misses", () => Observe(static values => values.MissCount), "{ray}", "Rays that escaped the scene.");
+        _meter.CreateObservableCounter("pathtracer.shadow_rays", () => Observe(static values => values.ShadowRayCount), "{ray}", "Shadow rays traced to the lights.");
+        _meter.CreateObservableCounter("pathtracer.russian_roulette_paths", () => Observe(static values => values.RussianRouletteCount), "{path}", "Paths ended by the Russian roulette.");
+        _meter.CreateObservableCounter("pathtracer.render_time", () => Observe(static values => values.RenderTime.TotalSeconds), "s", "Worker time spent tracing and shading tiles.");
+        _meter.CreateObservableCounter("pathtracer.accumulate_time", () => Observe(static values => values.AccumulateTime.TotalSeconds), "s", "Worker time spent accumulating tiles.");
+        _meter.CreateObservableCounter("pathtracer.convergence_time", () => Observe(static values => values.ConvergenceTime.TotalSeconds), "s", "Time spent updating the adaptive sampling convergence.");
+        _meter.CreateObservableGauge("pathtracer.bounces_per_path", () => Observe(static values => values.BouncesPerPath), "{bounce}", "Average path length in rays per sample since the start.");
+        _meter.CreateObservableGauge("pathtracer.hit_ratio", () => Observe(static values => values.HitRatio), null, "Ratio of rays that hit a primitive since the start.");
+    }
+
+    public void Add(string rendererName, RenderCounters counters)
+    {
+        ArgumentNullException.ThrowIfNull(rendererName);
+        ArgumentNullException.ThrowIfNull(counters);
+
+        lock (_renderers)
+        {
+            _renderers.Add((rendererName, counters));
+        }
+    }
+
+    public void Dispose()
+    {
+        _meter.Dispose();
+    }
+
+    private List<Measurement<T>> Observe<T>(Func<RenderCounterValues, T> selector) where T : struct
+    {
+        lock (_renderers)
+        {
+            var measurements = new List<Measurement<T>>(_renderers.Count);
+
+            foreach (var (name, counters) in _renderers)
+            {
+                measurements.Add(new Measurement<T>(selector(counters.GetValues()), new KeyValuePair<string, object?>("renderer", name)));
+            }
+
+            return measurements;
+        }
+    }
+}
\ No newline at end of file
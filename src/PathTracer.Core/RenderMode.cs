@@ -0,0 +1,7 @@
+namespace PathTracer.Core;
+
+public enum RenderMode
+{
+    PerPixel,
+    Wavefront
+}
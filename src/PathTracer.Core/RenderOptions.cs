@@ -0,0 +1,50 @@
+namespace PathTracer.Core;
+
+public readonly record struct RenderOptions
+{
+    public RenderOptions()
+    {
+        RenderMode = RenderMode.PerPixel;
+        TileSize = 32;
+        TileOrder = TileOrder.Morton;
+        ThreadCount = 0;
+        MaxBounceCount = 8;
+        RussianRouletteBounceCount = 3;
+        ToneMappingOperator = ToneMappingOperator.Clamp;
+        AdaptiveErrorThreshold = 0.0f;
+        IsJitterEnabled = true;
+        IsDenoiserEnabled = false;
+    }
+
+    public RenderMode RenderMode { get; init; }
+    public int TileSize { get; init; }
+    public TileOrder TileOrder { get; init; }
+
+    // NOTE: 0 uses all the logical processors
+    public int ThreadCount { get; init; }
+
+    public int MaxBounceCount { get; init; }
+
+    // NOTE: Paths can be ended by the Russian roulette once they traced this number of rays,
+    // the survivors are divided by their survival probability so the image stays unbiased.
+    // A value equal or greater than the max bounce count disables the roulette.
+    public int RussianRouletteBounceCount { get; init; }
+
+    public ToneMappingOperator ToneMappingOperator { get; init; }
+
+    // NOTE: Blocks of pixels stop receiving samples once the relative standard error of their
+    // luminance is below this threshold, 0 disables adaptive sampling
+    public float AdaptiveErrorThreshold { get; init; }
+
+    // NOTE: Primary rays go through a random point of their pixel so accumulated frames are
+    // antialiased, otherwise every sample goes through the corner of the pixel
+    public bool IsJitterEnabled { get; init; }
+
+    // NOTE: Images are filtered by the denoiser before they are written, their accumulation
+    // buffers must have features
+    public bool IsDenoiserEnabled { get; init; }
+
+    // NOTE: Part of the image rendered into the accumulation buffer, which must have the size
+    // of the region. An empty region renders the whole image.
+    public Tile Region { get; init; }
+}
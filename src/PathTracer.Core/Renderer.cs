@@ -1,19 +1,41 @@
+using System.Collections.Concurrent;
+using System.Diagnostics;
+
 namespace PathTracer.Core;
 
 public class Renderer<TImage, TParameter> : IRenderer<TImage, TParameter> where TImage : IImage
 {
-    private static readonly Random _random = new Random();
+    private const float RayOffset = 0.0001f;
+
+    private static readonly Vector3 _skyColor = new Vector3(0.6f, 0.7f, 0.9f);
+
     private readonly IImageWriter<TImage, TParameter> _imageWriter;
     private readonly IRandomGenerator _randomGenerator;
 
+    // NOTE: Tiles and worker buffers are kept between frames so rendering the same image
+    // again doesn't allocate. Render can run concurrently so both are thread safe.
+    private readonly ConcurrentBag<TileBuffers> _tileBuffers;
+    private TileLayout? _tileLayout;
+    private PrimaryRayCache? _primaryRayCache;
+
     public Renderer(IImageWriter<TImage, TParameter> imageWriter, IRandomGenerator randomGenerator)
     {
         _imageWriter = imageWriter;
         _randomGenerator = randomGenerator;
+        _tileBuffers = [];
+
+        Counters = new RenderCounters();
     }
 
-    public void Render(TImage image, Scene scene, Camera camera)
+    public RenderCounters Counters { get; }
+
+    public void Render(TImage image, Scene scene, Camera camera, RenderOptions renderOptions, CancellationToken cancellationToken)
     {
+        ArgumentNullException.ThrowIfNull(scene);
+        ArgumentOutOfRangeException.ThrowIfNegative(renderOptions.MaxBounceCount);
+        ArgumentOutOfRangeException.ThrowIfNegative(renderOptions.RussianRouletteBounceCount);
+        ArgumentOutOfRangeException.ThrowIfNegative(renderOptions.AdaptiveErrorThreshold);
+
         if (image.Width == 0 || image.Height == 0)
         {
             throw new ArgumentOutOfRangeException(nameof(image), "Image cannot have a width or height of 0.");
@@ -21,26 +43,71 @@ public class Renderer<TImage, TParameter> : IRenderer<TImage, TParameter> where
 
         var imageWidth = image.Width;
         var imageHeight = image.Height;
-        var rayGenerator = new RayGenerator(camera);
+        var accumulationBuffer = image.AccumulationBuffer;
+        var region = renderOptions.Region.PixelCount > 0 ? renderOptions.Region : new Tile { X = 0, Y = 0, Width = imageWidth, Height = imageHeight };
 
-        //for (var i = 0; i < imageHeight; i++)
-        Parallel.For(0, imageHeight, (i) =>
+        if (region.X < 0 || region.Y < 0 || region.X + region.Width > imageWidth || region.Y + region.Height > imageHeight)
         {
-            for (var j = 0; j < imageWidth; j++)
-            {
-                var u = (float)j / imageWidth;
-                var v = (float)i / imageHeight;
+            throw new ArgumentOutOfRangeException(nameof(renderOptions), "Render region must be inside the image.");
+        }
+
+        if (accumulationBuffer.Width != region.Width || accumulationBuffer.Height != region.Height)
+        {
+            throw new ArgumentOutOfRangeException(nameof(image), "Image accumulation buffer must have the same size as the rendered region.");
+        }
+
+        var primaryRayCache = GetPrimaryRayCache(camera, imageWidth, imageHeight);
+        var accelerationStructure = scene.AccelerationStructure ?? BoundingVolumeHierarchy.Build(scene.Spheres);
+        var instanceAccelerationStructure = scene.Instances.Count > 0 ? scene.InstanceAccelerationStructure ?? InstanceAccelerationStructure.Build(scene.Geometries, scene.Instances) : null;
 
-                var pixelCoordinates = new Vector2(u, v);
+        var tiles = GetTiles(region.Width, region.Height, renderOptions.TileSize, renderOptions.TileOrder);
+        var workerCount = renderOptions.ThreadCount > 0 ? renderOptions.ThreadCount : Environment.ProcessorCount;
+        var tileCapacity = renderOptions.TileSize * renderOptions.TileSize;
+        var isWavefront = renderOptions.RenderMode == RenderMode.Wavefront;
+        var maxBounceCount = renderOptions.MaxBounceCount;
+        var russianRouletteBounceCount = renderOptions.RussianRouletteBounceCount;
+        var isJitterEnabled = renderOptions.IsJitterEnabled;
 
-                // Remap pixel coordinates to [-1, 1] range
-                pixelCoordinates = pixelCoordinates * 2.0f - new Vector2(1.0f, 1.0f);
+        cancellationToken.ThrowIfCancellationRequested();
+        var frameIndex = accumulationBuffer.BeginFrame();
 
-                var color = PixelShader(pixelCoordinates, _randomGenerator, rayGenerator, scene);
-                _imageWriter.StorePixel(image, j, i, color);
+        TileScheduler.Run(tiles, workerCount, () => RentTileBuffers(tileCapacity, isWavefront), (tile, buffers) =>
+        {
+            if (accumulationBuffer.IsTileConverged(tile))
+            {
+                return;
+            }
+
+            var counters = new RenderCounterValues();
+            var startTimestamp = Stopwatch.GetTimestamp();
+
+            if (isWavefront)
+            {
+                RenderTileWavefront(image, tile, region, frameIndex, maxBounceCount, russianRouletteBounceCount, isJitterEnabled, buffers, primaryRayCache, scene, accelerationStructure, instanceAccelerationStructure, ref counters);
             }
-        });
-        //}
+            else
+            {
+                RenderTile(image, tile, region, frameIndex, maxBounceCount, russianRouletteBounceCount, isJitterEnabled, buffers, primaryRayCache, scene, accelerationStructure, instanceAccelerationStructure, ref counters);
+            }
+
+            var accumulateTimestamp = Stopwatch.GetTimestamp();
+            accumulationBuffer.AccumulateTile(tile, frameIndex, buffers.Samples.AsSpan(0, tile.PixelCount), buffers.Features.AsSpan(0, tile.PixelCount));
+
+            counters.RenderTicks = accumulateTimestamp - startTimestamp;
+            counters.AccumulateTicks = Stopwatch.GetTimestamp() - accumulateTimestamp;
+            Counters.Add(counters);
+        },
+        _tileBuffers.Add,
+        cancellationToken);
+
+        // NOTE: Convergence is only updated between frames so the workers never see a block
+        // change state in the middle of a tile
+        if (renderOptions.AdaptiveErrorThreshold > 0.0f)
+        {
+            var startTimestamp = Stopwatch.GetTimestamp();
+            accumulationBuffer.UpdateConvergence(renderOptions.AdaptiveErrorThreshold);
+            Counters.Add(new RenderCounterValues { ConvergenceTicks = Stopwatch.GetTimestamp() - startTimestamp });
+        }
     }
 
     public void CommitImage(TImage image, TParameter parameter)
@@ -48,85 +115,437 @@ public class Renderer<TImage, TParameter> : IRenderer<TImage, TParameter> where
         _imageWriter.CommitImage(image, parameter);
     }
 
-    private static Vector4 PixelShader(Vector2 pixelCoordinates, IRandomGenerator randomGenerator, RayGenerator rayGenerator, Scene scene)
+    private Tile[] GetTiles(int width, int height, int tileSize, TileOrder tileOrder)
+    {
+        var tileLayout = Volatile.Read(ref _tileLayout);
+
+        if (tileLayout is null || tileLayout.Width != width || tileLayout.Height != height || tileLayout.TileSize != tileSize || tileLayout.TileOrder != tileOrder)
+        {
+            tileLayout = new TileLayout
+            {
+                Width = width,
+                Height = height,
+                TileSize = tileSize,
+                TileOrder = tileOrder,
+                Tiles = TileScheduler.CreateTiles(width, height, tileSize, tileOrder)
+            };
+
+            Volatile.Write(ref _tileLayout, tileLayout);
+        }
+
+        return tileLayout.Tiles;
+    }
+
+    // NOTE: Buffers of another tile size are dropped, per pixel renders can use wavefront buffers
+    private TileBuffers RentTileBuffers(int capacity, bool isWavefront)
+    {
+        while (_tileBuffers.TryTake(out var buffers))
+        {
+            if (buffers.Capacity == capacity && (buffers.IsWavefront || !isWavefront))
+            {
+                return buffers;
+            }
+        }
+
+        return new TileBuffers(capacity, isWavefront);
+    }
+
+    private PrimaryRayCache GetPrimaryRayCache(Camera camera, int imageWidth, int imageHeight)
+    {
+        var primaryRayCache = Volatile.Read(ref _primaryRayCache);
+
+        if (primaryRayCache is null || !primaryRayCache.Matches(camera, imageWidth, imageHeight))
+        {
+            primaryRayCache = new PrimaryRayCache(camera, imageWidth, imageHeight);
+            Volatile.Write(ref _primaryRayCache, primaryRayCache);
+        }
+
+        return primaryRayCache;
+    }
+
+    // NOTE: The jitter uses the first dimension of the pixel random state so low discrepancy
+    // generators spread the samples of a pixel over its area
+    private Vector2 GetJitter(bool isJitterEnabled, ref RandomState randomState)
+    {
+        if (!isJitterEnabled)
+        {
+            return Vector2.Zero;
+        }
+
+        var random = _randomGenerator.GetVector3(ref randomState);
+        return new Vector2(random.X + 0.5f, random.Y + 0.5f);
+    }
+
+    // NOTE: Tiles are in accumulation buffer space, pixel coordinates and random states use
+    // image space so a region renders exactly like the same pixels of the whole image
+    private void RenderTile(TImage image, Tile tile, Tile region, int sampleIndex, int maxBounceCount, int russianRouletteBounceCount, bool isJitterEnabled, TileBuffers buffers, PrimaryRayCache primaryRayCache, Scene scene, BoundingVolumeHierarchy accelerationStructure, InstanceAccelerationStructure? instanceAccelerationStructure, ref RenderCounterValues counters)
+    {
+        var accumulationBuffer = image.AccumulationBuffer;
+        var samples = buffers.Samples.AsSpan();
+        var features = buffers.Features.AsSpan();
+
+        for (var i = 0; i < tile.Height; i++)
+        {
+            var y = region.Y + tile.Y + i;
+            var rowDirection = primaryRayCache.GetRowDirection(0, y);
+
+            for (var j = 0; j < tile.Width; j++)
+            {
+                if (accumulationBuffer.IsPixelConverged(tile.X + j, tile.Y + i))
+                {
+                    continue;
+                }
+
+                var x = region.X + tile.X + j;
+                var randomState = _randomGenerator.CreateState(y * image.Width + x, sampleIndex);
+                var ray = primaryRayCache.GenerateRay(rowDirection, x, GetJitter(isJitterEnabled, ref randomState));
+
+                samples[i * tile.Width + j] = PixelShader(ray, maxBounceCount, russianRouletteBounceCount, _randomGenerator, ref randomState, scene, accelerationStructure, instanceAccelerationStructure, out features[i * tile.Width + j], ref counters);
+                counters.SampleCount++;
+            }
+        }
+    }
+
+    // NOTE: Features are the ones of the first hit, paths without bounces have the features of a miss
+    private static Vector4 PixelShader(Ray ray, int maxBounceCount, int russianRouletteBounceCount, IRandomGenerator randomGenerator, ref RandomState randomState, Scene scene, BoundingVolumeHierarchy accelerationStructure, InstanceAccelerationStructure? instanceAccelerationStructure, out PixelFeatures features, ref RenderCounterValues counters)
     {
-        var ray = rayGenerator.GenerateRay(pixelCoordinates);
         var color = Vector3.Zero;
-        var multiplier = 1.0f;
+        var throughput = Vector3.One;
 
-        for (var i = 0; i < 5; i ++)
-        {   
-            var payload = TraceRay(scene, ray);
+        features = GetMissFeatures();
+
+        for (var i = 0; i < maxBounceCount; i++)
+        {
+            var payload = TraceRay(scene, accelerationStructure, instanceAccelerationStructure, ray, ref counters);
 
             if (payload.HitDistance < 0.0f)
             {
-                var skyColor = new Vector3(0.6f, 0.7f, 0.9f);
-                color += skyColor * multiplier;
+                color += ShadeMiss(throughput);
                 break;
             }
 
-            // Remap the normal to color space
-            //return new Vector4(0.5f * (normal + new Vector3(1, 1, 1)), 1.0f);
+            if (i == 0)
+            {
+                features = GetHitFeatures(scene, payload);
+            }
 
-            // Compute light
-            var lightDirection = new Vector3(1.0f, -1.0f, 1.0f);
-            var light = MathF.Max(Vector3.Dot(payload.WorldNormal, -lightDirection), 0.0f);
+            var isRussianRouletteEnabled = IsRussianRouletteEnabled(i, maxBounceCount, russianRouletteBounceCount);
+            var isPathAlive = ShadeHit(scene, ray, payload, isRussianRouletteEnabled, randomGenerator, ref randomState, ref color, ref throughput, out ray, out var shadowRay, ref counters);
 
-            var sphere = scene.Spheres[payload.ObjectIndex];
-            var material = scene.Materials[sphere.MaterialIndex];
+            if (shadowRay.Contribution != Vector3.Zero && !IsOccluded(accelerationStructure, instanceAccelerationStructure, shadowRay, ref counters))
+            {
+                color += shadowRay.Contribution;
+            }
 
-            color += light * material.Albedo * multiplier;
-            multiplier *= 0.4f;
+            if (!isPathAlive)
+            {
+                break;
+            }
+        }
+
+        return new Vector4(color, 1.0f);
+    }
 
-            ray = ray with
+    // NOTE: Wavefront path: each stage runs as a batch loop over the whole tile before the next
+    // stage starts. Paths that escape the scene or end at a hit are removed and the survivors
+    // are compacted at the front of the queue so every bounce only iterates over live rays.
+    // Shadow rays of the shade stage are queued and traced together. Converged pixels are
+    // never enqueued. The rays of a batch are still traced one at a time with TraceRay, there
+    // is no packet traversal of the hierarchy.
+    private void RenderTileWavefront(TImage image, Tile tile, Tile region, int sampleIndex, int maxBounceCount, int russianRouletteBounceCount, bool isJitterEnabled, TileBuffers queue, PrimaryRayCache primaryRayCache, Scene scene, BoundingVolumeHierarchy accelerationStructure, InstanceAccelerationStructure? instanceAccelerationStructure, ref RenderCounterValues counters)
+    {
+        var pixelCount = tile.PixelCount;
+        var rays = queue.Rays.AsSpan();
+        var payloads = queue.Payloads.AsSpan();
+        var throughputs = queue.Throughputs.AsSpan();
+        var shadowRays = queue.ShadowRays.AsSpan();
+        var shadowPixelIndices = queue.ShadowPixelIndices.AsSpan();
+        var pixelIndices = queue.PixelIndices.AsSpan();
+        var colors = queue.Colors.AsSpan();
+        var randomStates = queue.RandomStates.AsSpan();
+        var features = queue.Features.AsSpan();
+
+        var accumulationBuffer = image.AccumulationBuffer;
+        var activeCount = 0;
+        var rowDirection = Vector3.Zero;
+
+        // Generate stage
+        for (var i = 0; i < pixelCount; i++)
+        {
+            var (y, x) = Math.DivRem(i, tile.Width);
+            colors[i] = Vector3.Zero;
+            features[i] = GetMissFeatures();
+
+            if (x == 0)
             {
-                Origin = payload.WorldPosition + payload.WorldNormal * 0.0001f,
-                Direction = Vector3.Reflect(ray.Direction, payload.WorldNormal + material.Roughness * randomGenerator.GetVector3())
-            };
+                rowDirection = primaryRayCache.GetRowDirection(0, region.Y + tile.Y + y);
+            }
+
+            if (accumulationBuffer.IsPixelConverged(tile.X + x, tile.Y + y))
+            {
+                continue;
+            }
+
+            var imageX = region.X + tile.X + x;
+            var imageY = region.Y + tile.Y + y;
+
+            randomStates[i] = _randomGenerator.CreateState(imageY * image.Width + imageX, sampleIndex);
+            rays[activeCount] = primaryRayCache.GenerateRay(rowDirection, imageX, GetJitter(isJitterEnabled, ref randomStates[i]));
+            throughputs[activeCount] = Vector3.One;
+            pixelIndices[activeCount] = i;
+            activeCount++;
+        }
+
+        counters.SampleCount += activeCount;
+
+        for (var bounce = 0; bounce < maxBounceCount && activeCount > 0; bounce++)
+        {
+            // Intersect stage
+            for (var i = 0; i < activeCount; i++)
+            {
+                payloads[i] = TraceRay(scene, accelerationStructure, instanceAccelerationStructure, rays[i], ref counters);
+            }
+
+            // Miss stage
+            for (var i = 0; i < activeCount; i++)
+            {
+                if (payloads[i].HitDistance < 0.0f)
+                {
+                    colors[pixelIndices[i]] += ShadeMiss(throughputs[i]);
+                }
+            }
+
+            // Shade stage, survivors are compacted for the next bounce
+            var survivorCount = 0;
+            var shadowRayCount = 0;
+            var isRussianRouletteEnabled = IsRussianRouletteEnabled(bounce, maxBounceCount, russianRouletteBounceCount);
+
+            for (var i = 0; i < activeCount; i++)
+            {
+                if (payloads[i].HitDistance < 0.0f)
+                {
+                    continue;
+                }
+
+                var pixelIndex = pixelIndices[i];
+                var throughput = throughputs[i];
+
+                if (bounce == 0)
+                {
+                    features[pixelIndex] = GetHitFeatures(scene, payloads[i]);
+                }
+
+                var isPathAlive = ShadeHit(scene, rays[i], payloads[i], isRussianRouletteEnabled, _randomGenerator, ref randomStates[pixelIndex], ref colors[pixelIndex], ref throughput, out var nextRay, out var shadowRay, ref counters);
+
+                if (shadowRay.Contribution != Vector3.Zero)
+                {
+                    shadowRays[shadowRayCount] = shadowRay;
+                    shadowPixelIndices[shadowRayCount] = pixelIndex;
+                    shadowRayCount++;
+                }
+
+                if (isPathAlive)
+                {
+                    rays[survivorCount] = nextRay;
+                    throughputs[survivorCount] = throughput;
+                    pixelIndices[survivorCount] = pixelIndex;
+                    survivorCount++;
+                }
+            }
+
+            // Shadow stage
+            for (var i = 0; i < shadowRayCount; i++)
+            {
+                if (!IsOccluded(accelerationStructure, instanceAccelerationStructure, shadowRays[i], ref counters))
+                {
+                    colors[shadowPixelIndices[i]] += shadowRays[i].Contribution;
+                }
+            }
+
+            activeCount = survivorCount;
         }
 
-        return new Vector4(color, 1.0f); 
+        var samples = queue.Samples.AsSpan();
+
+        for (var i = 0; i < pixelCount; i++)
+        {
+            samples[i] = new Vector4(colors[i], 1.0f);
+        }
     }
 
-    private static RayHitPayload TraceRay(Scene scene, Ray ray)
+    private static PixelFeatures GetMissFeatures()
     {
-        int intersectObjectIndex = -1;
-        var minimumHitDistance = float.MaxValue;
+        return new PixelFeatures { Albedo = Vector3.One };
+    }
 
-        for (var i = 0; i < scene.Spheres.Count; i++)
+    private static PixelFeatures GetHitFeatures(Scene scene, RayHitPayload payload)
+    {
+        return new PixelFeatures
         {
-            var sphere = scene.Spheres[i];
+            Albedo = scene.Materials[payload.MaterialIndex].Albedo,
+            Normal = payload.WorldNormal,
+            Depth = payload.HitDistance
+        };
+    }
+
+    private static Vector3 ShadeMiss(Vector3 throughput)
+    {
+        return _skyColor * throughput;
+    }
+
+    // NOTE: Adds the emission of the hit, prepares the shadow ray of the next event estimation
+    // and samples the Bsdf for the next bounce. The shadow ray only has to be traced when its
+    // contribution is not zero. Returns false when the path ends at this hit.
+    private static bool ShadeHit(Scene scene, Ray ray, RayHitPayload payload, bool isRussianRouletteEnabled, IRandomGenerator randomGenerator, ref RandomState randomState, ref Vector3 color, ref Vector3 throughput, out Ray nextRay, out ShadowRay shadowRay, ref RenderCounterValues counters)
+    {
+        var material = scene.Materials[payload.MaterialIndex];
+        var outgoing = -ray.Direction;
 
-            var currentRay = ray with { Origin = ray.Origin - sphere.Position };
+        // Rays never start inside a sphere, the normal can only face away at grazing angles
+        var normal = Vector3.Dot(payload.WorldNormal, outgoing) < 0.0f ? -payload.WorldNormal : payload.WorldNormal;
+        var origin = payload.WorldPosition + normal * RayOffset;
 
-            // Construct quadratic function components
-            var a = Vector3.Dot(currentRay.Direction, currentRay.Direction);
-            var b = 2.0f * Vector3.Dot(currentRay.Origin, currentRay.Direction);
-            var c = Vector3.Dot(currentRay.Origin, currentRay.Origin) - sphere.Radius * sphere.Radius;
+        color += material.Emission * throughput;
 
-            // Solve quadratic function
-            var discriminant = b * b - 4.0f * a * c;
+        var lightRandom = GetRandomVector3(randomGenerator, ref randomState);
+        shadowRay = Bsdf.IsMirror(material) ? default : SampleLight(scene, origin, normal, outgoing, material, lightRandom, throughput);
+
+        if (!Bsdf.Sample(material, normal, outgoing, GetRandomVector3(randomGenerator, ref randomState), out var incoming, out var weight))
+        {
+            nextRay = ray;
+            return false;
+        }
 
-            if (discriminant < 0.0f)
+        throughput *= weight;
+        nextRay = new Ray { Origin = origin, Direction = incoming };
+
+        if (isRussianRouletteEnabled)
+        {
+            // NOTE: Paths survive with the probability of their brightest throughput channel so
+            // dark paths are ended early, bright paths are never ended
+            var survivalProbability = MathF.Min(MathF.Max(throughput.X, MathF.Max(throughput.Y, throughput.Z)), 1.0f);
+
+            if (GetRandomVector3(randomGenerator, ref randomState).X >= survivalProbability)
             {
-                continue;
+                counters.RussianRouletteCount++;
+                return false;
+            }
+
+            throughput /= survivalProbability;
+        }
+
+        return true;
+    }
+
+    // NOTE: The roulette is not needed for the last bounce, the path ends there anyway
+    private static bool IsRussianRouletteEnabled(int bounce, int maxBounceCount, int russianRouletteBounceCount)
+    {
+        return bounce + 1 >= russianRouletteBounceCount && bounce + 1 < maxBounceCount;
+    }
+
+    // NOTE: One light is picked at random for each hit, its contribution is divided by the
+    // probability of the pick. Point lights with a radius use a random point of their sphere.
+    private static ShadowRay SampleLight(Scene scene, Vector3 origin, Vector3 normal, Vector3 outgoing, in Material material, Vector3 random, Vector3 throughput)
+    {
+        var lightCount = scene.Lights.Count;
+
+        if (lightCount == 0)
+        {
+            return default;
+        }
+
+        var light = scene.Lights[Math.Min((int)(random.X * lightCount), lightCount - 1)];
+        var radiance = light.Color * (light.Intensity * lightCount);
+        Vector3 direction;
+        float distance;
+
+        if (light.Type == LightType.Directional)
+        {
+            if (light.Direction == Vector3.Zero)
+            {
+                return default;
             }
 
-            var t = (-b + -MathF.Sqrt(discriminant)) / (2.0f * a);
+            direction = -Vector3.Normalize(light.Direction);
+            distance = float.MaxValue;
+        }
+        else
+        {
+            var lightDirection = light.Position + light.Radius * SampleSphere(random.Y, random.Z) - origin;
+            var distanceSquared = lightDirection.LengthSquared();
 
-            if (t > 0 && t < minimumHitDistance)
+            if (distanceSquared == 0.0f)
             {
-                intersectObjectIndex = i;
-                minimumHitDistance = t;
+                return default;
             }
+
+            distance = MathF.Sqrt(distanceSquared);
+            direction = lightDirection / distance;
+            radiance /= distanceSquared;
         }
 
-        if (intersectObjectIndex == -1)
+        return new ShadowRay
         {
+            Ray = new Ray { Origin = origin, Direction = direction },
+            Distance = distance,
+            Contribution = Bsdf.EvaluateLight(material, normal, outgoing, direction) * radiance * throughput
+        };
+    }
+
+    private static Vector3 SampleSphere(float u, float v)
+    {
+        var z = 1.0f - 2.0f * u;
+        var radius = MathF.Sqrt(MathF.Max(1.0f - z * z, 0.0f));
+        var (sin, cos) = MathF.SinCos(2.0f * MathF.PI * v);
+
+        return new Vector3(radius * cos, radius * sin, z);
+    }
+
+    private static Vector3 GetRandomVector3(IRandomGenerator randomGenerator, ref RandomState randomState)
+    {
+        return randomGenerator.GetVector3(ref randomState) + new Vector3(0.5f);
+    }
+
+    // NOTE: Shadow rays use the any hit queries, the first occluder ends the traversal
+    private static bool IsOccluded(BoundingVolumeHierarchy accelerationStructure, InstanceAccelerationStructure? instanceAccelerationStructure, in ShadowRay shadowRay, ref RenderCounterValues counters)
+    {
+        var intersectionTestCount = 0L;
+        var hitDistance = shadowRay.Distance;
+
+        var isOccluded = accelerationStructure.IntersectAny(shadowRay.Ray, ref hitDistance, ref intersectionTestCount) ||
+                         (instanceAccelerationStructure is not null && instanceAccelerationStructure.IntersectAny(shadowRay.Ray, ref hitDistance, ref intersectionTestCount));
+
+        counters.ShadowRayCount++;
+        counters.IntersectionTestCount += intersectionTestCount;
+
+        return isOccluded;
+    }
+
+    private static RayHitPayload TraceRay(Scene scene, BoundingVolumeHierarchy accelerationStructure, InstanceAccelerationStructure? instanceAccelerationStructure, Ray ray, ref RenderCounterValues counters)
+    {
+        var intersectionTestCount = 0L;
+        var hitDistance = float.MaxValue;
+        var objectIndex = -1;
+        var instanceIndex = -1;
+
+        var isHit = accelerationStructure.IntersectClosest(ray, ref hitDistance, ref objectIndex, ref intersectionTestCount);
+
+        if (instanceAccelerationStructure is not null && instanceAccelerationStructure.IntersectClosest(ray, ref hitDistance, ref instanceIndex, ref objectIndex, ref intersectionTestCount))
+        {
+            isHit = true;
+        }
+
+        counters.RayCount++;
+        counters.IntersectionTestCount += intersectionTestCount;
+
+        if (!isHit)
+        {
+            counters.MissCount++;
             return MissShader(ray);
         }
 
-        return ClosestHitShader(scene, ray, minimumHitDistance, intersectObjectIndex);
+        counters.HitCount++;
+        return instanceIndex >= 0 ? ClosestHitShader(scene, ray, hitDistance, instanceIndex, objectIndex) : ClosestHitShader(scene, ray, hitDistance, objectIndex);
     }
 
     private static RayHitPayload ClosestHitShader(Scene scene, Ray ray, float hitDistance, int objectIndex)
@@ -141,11 +560,34 @@ public class Renderer<TImage, TParameter> : IRenderer<TImage, TParameter> where
         {
             HitDistance = hitDistance,
             ObjectIndex = objectIndex,
+            InstanceIndex = -1,
+            MaterialIndex = sphere.MaterialIndex,
             WorldPosition = intersectPoint + sphere.Position,
             WorldNormal = normal
         };
     }
 
+    private static RayHitPayload ClosestHitShader(Scene scene, Ray ray, float hitDistance, int instanceIndex, int objectIndex)
+    {
+        var instance = scene.Instances[instanceIndex];
+        var sphere = scene.Geometries[instance.GeometryIndex].Spheres[objectIndex];
+        var spherePosition = instance.Position + Vector3.Transform(sphere.Position * instance.Scale, Quaternion.Normalize(instance.Rotation));
+
+        ray = ray with { Origin = ray.Origin - spherePosition };
+        var intersectPoint = ray.GetPoint(hitDistance);
+        var normal = Vector3.Normalize(intersectPoint);
+
+        return new RayHitPayload
+        {
+            HitDistance = hitDistance,
+            ObjectIndex = objectIndex,
+            InstanceIndex = instanceIndex,
+            MaterialIndex = instance.MaterialIndex >= 0 ? instance.MaterialIndex : sphere.MaterialIndex,
+            WorldPosition = intersectPoint + spherePosition,
+            WorldNormal = normal
+        };
+    }
+
     private static RayHitPayload MissShader(Ray ray)
     {
         return new RayHitPayload
@@ -153,4 +595,56 @@ public class Renderer<TImage, TParameter> : IRenderer<TImage, TParameter> where
             HitDistance = -1.0f
         };
     }
+
+    // NOTE: Per worker scratch memory, the wavefront queue is only allocated when needed
+    private sealed class TileBuffers
+    {
+        public TileBuffers(int capacity, bool isWavefront)
+        {
+            var queueCapacity = isWavefront ? capacity : 0;
+
+            Capacity = capacity;
+            IsWavefront = isWavefront;
+            Samples = new Vector4[capacity];
+            Features = new PixelFeatures[capacity];
+            Rays = new Ray[queueCapacity];
+            Payloads = new RayHitPayload[queueCapacity];
+            Throughputs = new Vector3[queueCapacity];
+            PixelIndices = new int[queueCapacity];
+            Colors = new Vector3[queueCapacity];
+            RandomStates = new RandomState[queueCapacity];
+            ShadowRays = new ShadowRay[queueCapacity];
+            ShadowPixelIndices = new int[queueCapacity];
+        }
+
+        public int Capacity { get; }
+        public bool IsWavefront { get; }
+        public Vector4[] Samples { get; }
+        public PixelFeatures[] Features { get; }
+        public Ray[] Rays { get; }
+        public RayHitPayload[] Payloads { get; }
+        public Vector3[] Throughputs { get; }
+        public int[] PixelIndices { get; }
+        public Vector3[] Colors { get; }
+        public RandomState[] RandomStates { get; }
+        public ShadowRay[] ShadowRays { get; }
+        public int[] ShadowPixelIndices { get; }
+    }
+
+    // NOTE: Contribution already includes the throughput of the path
+    private readonly record struct ShadowRay
+    {
+        public Ray Ray { get; init; }
+        public float Distance { get; init; }
+        public Vector3 Contribution { get; init; }
+    }
+
+    private sealed record TileLayout
+    {
+        public required int Width { get; init; }
+        public required int Height { get; init; }
+        public required int TileSize { get; init; }
+        public required TileOrder TileOrder { get; init; }
+        public required Tile[] Tiles { get; init; }
+    }
 }
\ No newline at end of file
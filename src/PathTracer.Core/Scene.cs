@@ -1,16 +1,269 @@
 namespace PathTracer.Core;
 
+// NOTE: Edits made through the Update methods are tracked per object and applied by
+// CommitChanges, which only refits moved spheres and rebuilds hierarchies whose objects changed.
 public class Scene
 {
-    public Scene()
+    // NOTE: Refitting many spheres costs more than a rebuild and gives a worse hierarchy
+    private const int MaxRefitRatio = 4;
+
+    private readonly HashSet<int> _changedSphereIndices;
+    private readonly HashSet<int> _movedSphereIndices;
+    private readonly HashSet<int> _changedMaterialIndices;
+    private readonly HashSet<int> _changedGeometryIndices;
+    private readonly HashSet<int> _changedInstanceIndices;
+    private readonly HashSet<int> _changedLightIndices;
+
+    // NOTE: Data shared with the last snapshot, it is copied before its first edit
+    private SnapshotData _snapshotData;
+
+    public Scene() : this(new List<Sphere>(), new List<Material>())
     {
-        Spheres = new List<Sphere>();
-        Materials = new List<Material>();
     }
 
-    public IList<Sphere> Spheres { get; }
-    public IList<Material> Materials { get; }
+    public Scene(IList<Sphere> spheres, IList<Material> materials)
+    {
+        ArgumentNullException.ThrowIfNull(spheres);
+        ArgumentNullException.ThrowIfNull(materials);
+
+        Spheres = spheres;
+        Materials = materials;
+        Geometries = new List<GeometryBlock>();
+        Instances = new List<Instance>();
+        Lights = new List<Light>();
+
+        _changedSphereIndices = [];
+        _movedSphereIndices = [];
+        _changedMaterialIndices = [];
+        _changedGeometryIndices = [];
+        _changedInstanceIndices = [];
+        _changedLightIndices = [];
+    }
+
+    public IList<Sphere> Spheres { get; private set; }
+    public IList<Material> Materials { get; private set; }
+    public IList<GeometryBlock> Geometries { get; private set; }
+    public IList<Instance> Instances { get; private set; }
+    public IList<Light> Lights { get; private set; }
+    public int Version { get; private set; }
+    public IReadOnlyCollection<int> ChangedSphereIndices => _changedSphereIndices;
+    public IReadOnlyCollection<int> ChangedMaterialIndices => _changedMaterialIndices;
+
+    // NOTE: Optional prebuilt acceleration structure, usually loaded from a scene file.
+    // When it is null the renderer builds one for every frame.
+    public BoundingVolumeHierarchy? AccelerationStructure { get; set; }
+
+    // NOTE: Null when the scene has no instances
+    public InstanceAccelerationStructure? InstanceAccelerationStructure { get; set; }
+
+    public void UpdateSphere(int index, Sphere sphere)
+    {
+        var previousSphere = Spheres[index];
+
+        if (sphere == previousSphere)
+        {
+            return;
+        }
+
+        Spheres = GetWritableList(Spheres, SnapshotData.Spheres);
+        Spheres[index] = sphere;
+        _changedSphereIndices.Add(index);
+
+        if (sphere.Position != previousSphere.Position || sphere.Radius != previousSphere.Radius)
+        {
+            _movedSphereIndices.Add(index);
+        }
+
+        Version++;
+    }
 
-    // TODO: Temporary
-    public bool HasChanged { get; set; }
+    public void UpdateMaterial(int index, Material material)
+    {
+        if (material == Materials[index])
+        {
+            return;
+        }
+
+        Materials = GetWritableList(Materials, SnapshotData.Materials);
+        Materials[index] = material;
+        _changedMaterialIndices.Add(index);
+
+        Version++;
+    }
+
+    // NOTE: Blocks are shared with the snapshots, the first edit of a block replaces it with a
+    // copy whose hierarchy is built again by CommitChanges
+    public void UpdateGeometrySphere(int geometryIndex, int sphereIndex, Sphere sphere)
+    {
+        var geometry = Geometries[geometryIndex];
+
+        if (sphere == geometry.Spheres[sphereIndex])
+        {
+            return;
+        }
+
+        if (_changedGeometryIndices.Add(geometryIndex))
+        {
+            geometry = new GeometryBlock(new List<Sphere>(geometry.Spheres));
+            Geometries[geometryIndex] = geometry;
+        }
+
+        geometry.Spheres[sphereIndex] = sphere;
+
+        Version++;
+    }
+
+    public void UpdateInstance(int index, Instance instance)
+    {
+        if (instance == Instances[index])
+        {
+            return;
+        }
+
+        Instances = GetWritableList(Instances, SnapshotData.Instances);
+        Instances[index] = instance;
+        _changedInstanceIndices.Add(index);
+
+        Version++;
+    }
+
+    public void UpdateLight(int index, Light light)
+    {
+        if (light == Lights[index])
+        {
+            return;
+        }
+
+        Lights = GetWritableList(Lights, SnapshotData.Lights);
+        Lights[index] = light;
+        _changedLightIndices.Add(index);
+
+        Version++;
+    }
+
+    // NOTE: Builds the acceleration structure when there is none so it is reused between frames
+    public SceneChanges CommitChanges()
+    {
+        var isRebuilt = false;
+
+        if (AccelerationStructure is null || AccelerationStructure.PrimitiveIndices.Length != Spheres.Count || _movedSphereIndices.Count > Spheres.Count / MaxRefitRatio)
+        {
+            AccelerationStructure = BoundingVolumeHierarchy.Build(Spheres);
+            isRebuilt = true;
+            _snapshotData &= ~SnapshotData.AccelerationStructure;
+        }
+        else if (_movedSphereIndices.Count > 0)
+        {
+            // Refits update the hierarchy in place
+            if ((_snapshotData & SnapshotData.AccelerationStructure) != 0)
+            {
+                AccelerationStructure = AccelerationStructure.Clone();
+                _snapshotData &= ~SnapshotData.AccelerationStructure;
+            }
+
+            AccelerationStructure.Refit(Spheres, _movedSphereIndices);
+        }
+
+        if (CommitInstances())
+        {
+            isRebuilt = true;
+        }
+
+        var changes = new SceneChanges
+        {
+            ChangedSphereCount = _changedSphereIndices.Count,
+            MovedSphereCount = _movedSphereIndices.Count,
+            ChangedMaterialCount = _changedMaterialIndices.Count,
+            ChangedGeometryCount = _changedGeometryIndices.Count,
+            ChangedInstanceCount = _changedInstanceIndices.Count,
+            ChangedLightCount = _changedLightIndices.Count,
+            IsAccelerationStructureRebuilt = isRebuilt
+        };
+
+        _changedSphereIndices.Clear();
+        _movedSphereIndices.Clear();
+        _changedMaterialIndices.Clear();
+        _changedGeometryIndices.Clear();
+        _changedInstanceIndices.Clear();
+        _changedLightIndices.Clear();
+
+        return changes;
+    }
+
+    // NOTE: Copy of the scene for renders that run on other threads while this one is edited,
+    // it should be taken after CommitChanges. The lists and the sphere hierarchy are shared
+    // until they are edited so a snapshot doesn't copy the scene, the lists must then only be
+    // edited with the Update methods. Blocks and the top level hierarchy are only replaced.
+    public Scene CreateSnapshot()
+    {
+        var snapshot = new Scene(Spheres, Materials)
+        {
+            Instances = Instances,
+            Lights = Lights,
+            AccelerationStructure = AccelerationStructure,
+            InstanceAccelerationStructure = InstanceAccelerationStructure,
+            Version = Version,
+            _snapshotData = SnapshotData.All
+        };
+
+        foreach (var geometry in Geometries)
+        {
+            snapshot.Geometries.Add(new GeometryBlock(geometry.Spheres) { AccelerationStructure = geometry.AccelerationStructure });
+        }
+
+        _snapshotData = SnapshotData.All;
+        return snapshot;
+    }
+
+    // NOTE: Block hierarchies are only built for new or edited blocks, the top level is built
+    // again when a block or an instance changed
+    private bool CommitInstances()
+    {
+        var isRebuilt = false;
+
+        foreach (var geometry in Geometries)
+        {
+            if (geometry.AccelerationStructure is null || geometry.AccelerationStructure.PrimitiveIndices.Length != geometry.Spheres.Count)
+            {
+                geometry.AccelerationStructure = BoundingVolumeHierarchy.Build(geometry.Spheres);
+                isRebuilt = true;
+            }
+        }
+
+        if (Instances.Count == 0)
+        {
+            isRebuilt |= InstanceAccelerationStructure is not null;
+            InstanceAccelerationStructure = null;
+        }
+        else if (isRebuilt || InstanceAccelerationStructure is null || InstanceAccelerationStructure.InstanceCount != Instances.Count || _changedInstanceIndices.Count > 0)
+        {
+            InstanceAccelerationStructure = InstanceAccelerationStructure.Build(Geometries, Instances);
+            isRebuilt = true;
+        }
+
+        return isRebuilt;
+    }
+
+    private IList<T> GetWritableList<T>(IList<T> list, SnapshotData snapshotData)
+    {
+        if ((_snapshotData & snapshotData) == 0)
+        {
+            return list;
+        }
+
+        _snapshotData &= ~snapshotData;
+        return new List<T>(list);
+    }
+
+    [Flags]
+    private enum SnapshotData
+    {
+        None = 0,
+        Spheres = 1,
+        Materials = 2,
+        Instances = 4,
+        Lights = 8,
+        AccelerationStructure = 16,
+        All = Spheres | Materials | Instances | Lights | AccelerationStructure
+    }
 }
\ No newline at end of file
@@ -0,0 +1,14 @@
+namespace PathTracer.Core;
+
+public readonly record struct SceneChanges
+{
+    public int ChangedSphereCount { get; init; }
+    public int MovedSphereCount { get; init; }
+    public int ChangedMaterialCount { get; init; }
+    public int ChangedGeometryCount { get; init; }
+    public int ChangedInstanceCount { get; init; }
+    public int ChangedLightCount { get; init; }
+    public bool IsAccelerationStructureRebuilt { get; init; }
+
+    public bool HasChanges => ChangedSphereCount > 0 || ChangedMaterialCount > 0 || ChangedGeometryCount > 0 || ChangedInstanceCount > 0 || ChangedLightCount > 0 || IsAccelerationStructureRebuilt;
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+using System.IO.MemoryMappedFiles;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Binary scene format, also used in memory to send scenes to other processes. A fixed
+// header is followed by 64 byte aligned sections that each hold the raw memory of one array.
+public static class SceneFile
+{
+    public const string Extension = ".ptscene";
+
+    private const uint Magic = 0x43535450; // "PTSC"
+    private const int Version = 3;
+    private const int SectionAlignment = 64;
+
+    public static void Write(string path, Scene scene, Camera camera, BoundingVolumeHierarchy? accelerationStructure)
+    {
+        ArgumentNullException.ThrowIfNull(path);
+
+        using var stream = new FileStream(path, FileMode.Create, FileAccess.Write);
+        Write(stream, scene, camera, accelerationStructure);
+    }
+
+    // NOTE: The stream must be seekable, sections are written at their offset from the current position
+    public static void Write(Stream stream, Scene scene, Camera camera, BoundingVolumeHierarchy? accelerationStructure)
+    {
+        ArgumentNullException.ThrowIfNull(stream);
+        ArgumentNullException.ThrowIfNull(scene);
+
+        var spheres = GetSpan(scene.Spheres);
+        var materials = GetSpan(scene.Materials);
+        var nodes = accelerationStructure is not null ? accelerationStructure.Nodes : default;
+        var primitiveIndices = accelerationStructure is not null ? accelerationStructure.PrimitiveIndices : default;
+        var geometrySphereCounts = new int[scene.Geometries.Count];
+        var geometrySpheres = new List<Sphere>();
+        var instances = GetSpan(scene.Instances);
+        var lights = GetSpan(scene.Lights);
+
+        for (var i = 0; i < geometrySphereCounts.Length; i++)
+        {
+            geometrySphereCounts[i] = scene.Geometries[i].Spheres.Count;
+            geometrySpheres.AddRange(scene.Geometries[i].Spheres);
+        }
+
+        var spheresOffset = Align(Unsafe.SizeOf<SceneFileHeader>());
+        var materialsOffset = Align(spheresOffset + GetByteCount(spheres));
+        var nodesOffset = Align(materialsOffset + GetByteCount(materials));
+        var primitiveIndicesOffset = Align(nodesOffset + GetByteCount(nodes));
+        var geometrySphereCountsOffset = Align(primitiveIndicesOffset + GetByteCount(primitiveIndices));
+        var geometrySpheresOffset = Align(geometrySphereCountsOffset + GetByteCount<int>(geometrySphereCounts));
+        var instancesOffset = Align(geometrySpheresOffset + GetByteCount(GetSpan(geometrySpheres)));
+        var lightsOffset = Align(instancesOffset + GetByteCount(instances));
+
+        var header = new SceneFileHeader
+        {
+            Magic = Magic,
+            Version = Version,
+            SphereCount = spheres.Length,
+            SphereSize = Unsafe.SizeOf<Sphere>(),
+            MaterialCount = materials.Length,
+            MaterialSize = Unsafe.SizeOf<Material>(),
+            NodeCount = nodes.Length,
+            NodeSize = Unsafe.SizeOf<BoundingVolumeHierarchyNode>(),
+            MaxDepth = accelerationStructure?.MaxDepth ?? 0,
+            GeometryCount = geometrySphereCounts.Length,
+            GeometrySphereCount = geometrySpheres.Count,
+            InstanceCount = instances.Length,
+            InstanceSize = Unsafe.SizeOf<Instance>(),
+            LightCount = lights.Length,
+            LightSize = Unsafe.SizeOf<Light>(),
+            SpheresOffset = spheresOffset,
+            MaterialsOffset = materialsOffset,
+            NodesOffset = nodesOffset,
+            PrimitiveIndicesOffset = primitiveIndicesOffset,
+            GeometrySphereCountsOffset = geometrySphereCountsOffset,
+            GeometrySpheresOffset = geometrySpheresOffset,
+            InstancesOffset = instancesOffset,
+            LightsOffset = lightsOffset,
+            Camera = camera
+        };
+
+        var startPosition = stream.Position;
+
+        stream.Write(MemoryMarshal.AsBytes(new ReadOnlySpan<SceneFileHeader>(in header)));
+        WriteSection(stream, startPosition + spheresOffset, spheres);
+        WriteSection(stream, startPosition + materialsOffset, materials);
+        WriteSection(stream, startPosition + nodesOffset, nodes);
+        WriteSection(stream, startPosition + primitiveIndicesOffset, primitiveIndices);
+        WriteSection<int>(stream, startPosition + geometrySphereCountsOffset, geometrySphereCounts);
+        WriteSection(stream, startPosition + geometrySpheresOffset, GetSpan(geometrySpheres));
+        WriteSection(stream, startPosition + instancesOffset, instances);
+        WriteSection(stream, startPosition + lightsOffset, lights);
+    }
+
+    public static Scene Read(string path, out Camera camera)
+    {
+        ArgumentNullException.ThrowIfNull(path);
+
+        using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read);
+
+        if (stream.Length < Unsafe.SizeOf<SceneFileHeader>())
+        {
+            throw new InvalidDataException("Scene file is too small to contain a header.");
+        }
+
+        using var file = MemoryMappedFile.CreateFromFile(stream, null, 0, MemoryMappedFileAccess.Read, HandleInheritability.None, leaveOpen: true);
+        using var view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+
+        return Read(new SceneFileSource(view, stream.Length), out camera);
+    }
+
+    public static Scene Read(ReadOnlySpan<byte> data, out Camera camera)
+    {
+        if (data.Length < Unsafe.SizeOf<SceneFileHeader>())
+        {
+            throw new InvalidDataException("Scene file is too small to contain a header.");
+        }
+
+        return Read(new SceneFileSource(data), out camera);
+    }
+
+    private static Scene Read(SceneFileSource source, out Camera camera)
+    {
+        var header = new SceneFileHeader();
+        source.Read(0, new Span<SceneFileHeader>(ref header));
+
+        if (header.Magic != Magic)
+        {
+            throw new InvalidDataException("File is not a scene file.");
+        }
+
+        if (header.Version != Version)
+        {
+            throw new InvalidDataException($"Scene file version {header.Version} is not supported, expected version {Version}.");
+        }
+
+        if (header.SphereSize != Unsafe.SizeOf<Sphere>() || header.MaterialSize != Unsafe.SizeOf<Material>() || header.NodeSize != Unsafe.SizeOf<BoundingVolumeHierarchyNode>() || header.InstanceSize != Unsafe.SizeOf<Instance>() || header.LightSize != Unsafe.SizeOf<Light>())
+        {
+            throw new InvalidDataException("Scene file was written with a different memory layout.");
+        }
+
+        var spheres = ReadSection<Sphere>(source, header.SpheresOffset, header.SphereCount);
+        var materials = ReadSection<Material>(source, header.MaterialsOffset, header.MaterialCount);
+        ValidateMaterialIndices(spheres, materials.Count);
+
+        var scene = new Scene(spheres, materials);
+
+        ReadInstances(source, header, scene);
+
+        foreach (var light in ReadSection<Light>(source, header.LightsOffset, header.LightCount))
+        {
+            if (!Enum.IsDefined(light.Type))
+            {
+                throw new InvalidDataException($"Scene file light has an unknown type {(int)light.Type}.");
+            }
+
+            scene.Lights.Add(light);
+        }
+
+        if (header.NodeCount > 0)
+        {
+            var nodes = ReadArray<BoundingVolumeHierarchyNode>(source, header.NodesOffset, header.NodeCount);
+            var primitiveIndices = ReadArray<int>(source, header.PrimitiveIndicesOffset, header.SphereCount);
+
+            try
+            {
+                scene.AccelerationStructure = BoundingVolumeHierarchy.Create(spheres, nodes, primitiveIndices, header.MaxDepth);
+            }
+            catch (ArgumentException exception)
+            {
+                throw new InvalidDataException("Scene file contains an invalid acceleration structure.", exception);
+            }
+        }
+
+        camera = header.Camera;
+        return scene;
+    }
+
+    private static void ReadInstances(SceneFileSource source, SceneFileHeader header, Scene scene)
+    {
+        var geometrySphereCounts = ReadArray<int>(source, header.GeometrySphereCountsOffset, header.GeometryCount);
+
+        var geometrySpheres = ReadSection<Sphere>(source, header.GeometrySpheresOffset, header.GeometrySphereCount);
+        ValidateMaterialIndices(geometrySpheres, header.MaterialCount);
+
+        var firstIndex = 0;
+
+        foreach (var sphereCount in geometrySphereCounts)
+        {
+            if (sphereCount < 0 || sphereCount > geometrySpheres.Count - firstIndex)
+            {
+                throw new InvalidDataException("Scene file geometry references spheres outside of the geometry spheres.");
+            }
+
+            scene.Geometries.Add(new GeometryBlock(geometrySpheres.GetRange(firstIndex, sphereCount)));
+            firstIndex += sphereCount;
+        }
+
+        var instances = ReadSection<Instance>(source, header.InstancesOffset, header.InstanceCount);
+
+        foreach (var instance in instances)
+        {
+            if (instance.GeometryIndex < 0 || instance.GeometryIndex >= geometrySphereCounts.Length)
+            {
+                throw new InvalidDataException($"Scene file instance references geometry {instance.GeometryIndex} outside of the {geometrySphereCounts.Length} geometries.");
+            }
+
+            // Negative indices keep the materials of the block spheres
+            if (instance.MaterialIndex >= header.MaterialCount)
+            {
+                throw new InvalidDataException($"Scene file instance references material {instance.MaterialIndex} outside of the {header.MaterialCount} materials.");
+            }
+
+            scene.Instances.Add(instance);
+        }
+    }
+
+    // NOTE: The renderer indexes the materials without checks so a corrupted index must not
+    // reach it
+    private static void ValidateMaterialIndices(List<Sphere> spheres, int materialCount)
+    {
+        foreach (var sphere in spheres)
+        {
+            if (sphere.MaterialIndex < 0 || sphere.MaterialIndex >= materialCount)
+            {
+                throw new InvalidDataException($"Scene file sphere references material {sphere.MaterialIndex} outside of the {materialCount} materials.");
+            }
+        }
+    }
+
+    private static T[] ReadArray<T>(SceneFileSource source, long offset, int count) where T : unmanaged
+    {
+        ValidateSection<T>(source, offset, count);
+
+        var result = new T[count];
+        source.Read(offset, result.AsSpan());
+
+        return result;
+    }
+
+    private static List<T> ReadSection<T>(SceneFileSource source, long offset, int count) where T : unmanaged
+    {
+        ValidateSection<T>(source, offset, count);
+
+        var result = new List<T>(count);
+        CollectionsMarshal.SetCount(result, count);
+
+        source.Read(offset, CollectionsMarshal.AsSpan(result));
+        return result;
+    }
+
+    // NOTE: Counts come from the header, they are checked against the size of the file before
+    // anything is allocated so a corrupted count cannot allocate gigabytes
+    private static void ValidateSection<T>(SceneFileSource source, long offset, int count) where T : unmanaged
+    {
+        if (count < 0)
+        {
+            throw new InvalidDataException("Scene file section has a negative element count.");
+        }
+
+        if (count > 0 && (offset < 0 || offset > source.Length || (long)count * Unsafe.SizeOf<T>() > source.Length - offset))
+        {
+            throw new InvalidDataException("Scene file section is outside of the file.");
+        }
+    }
+
+    private static void WriteSection<T>(Stream stream, long offset, ReadOnlySpan<T> data) where T : unmanaged
+    {
+        // Seeking past the end fills the alignment padding with zeros
+        stream.Seek(offset, SeekOrigin.Begin);
+        stream.Write(MemoryMarshal.AsBytes(data));
+    }
+
+    private static ReadOnlySpan<T> GetSpan<T>(IList<T> list)
+    {
+        return list is List<T> items ? CollectionsMarshal.AsSpan(items) : list.ToArray();
+    }
+
+    private static long GetByteCount<T>(ReadOnlySpan<T> data) where T : unmanaged
+    {
+        return (long)data.Length * Unsafe.SizeOf<T>();
+    }
+
+    private static long Align(long offset)
+    {
+        return (offset + SectionAlignment - 1) / SectionAlignment * SectionAlignment;
+    }
+
+    // NOTE: Scene data is either a mapped file or a block of memory
+    private readonly ref struct SceneFileSource
+    {
+        private readonly MemoryMappedViewAccessor? _view;
+        private readonly ReadOnlySpan<byte> _data;
+        private readonly long _length;
+
+        public SceneFileSource(MemoryMappedViewAccessor view, long length)
+        {
+            _view = view;
+            _length = length;
+        }
+
+        public SceneFileSource(ReadOnlySpan<byte> data)
+        {
+            _data = data;
+            _length = data.Length;
+        }
+
+        public long Length => _length;
+
+        public void Read<T>(long offset, Span<T> destination) where T : unmanaged
+        {
+            if (destination.IsEmpty)
+            {
+                return;
+            }
+
+            var byteCount = GetByteCount<T>(destination);
+
+            if (offset < 0 || offset + byteCount > _length)
+            {
+                throw new InvalidDataException("Scene file section is outside of the file.");
+            }
+
+            if (_view is not null)
+            {
+                _view.SafeMemoryMappedViewHandle.ReadSpan((ulong)(_view.PointerOffset + offset), destination);
+            }
+            else
+            {
+                _data.Slice((int)offset, (int)byteCount).CopyTo(MemoryMarshal.AsBytes(destination));
+            }
+        }
+    }
+
+    private readonly record struct SceneFileHeader
+    {
+        public uint Magic { get; init; }
+        public int Version { get; init; }
+        public int SphereCount { get; init; }
+        public int SphereSize { get; init; }
+        public int MaterialCount { get; init; }
+        public int MaterialSize { get; init; }
+        public int NodeCount { get; init; }
+        public int NodeSize { get; init; }
+        public int MaxDepth { get; init; }
+        public int GeometryCount { get; init; }
+        public int GeometrySphereCount { get; init; }
+        public int InstanceCount { get; init; }
+        public int InstanceSize { get; init; }
+        public int LightCount { get; init; }
+        public int LightSize { get; init; }
+        public long SpheresOffset { get; init; }
+        public long MaterialsOffset { get; init; }
+        public long NodesOffset { get; init; }
+        public long PrimitiveIndicesOffset { get; init; }
+        public long GeometrySphereCountsOffset { get; init; }
+        public long GeometrySpheresOffset { get; init; }
+        public long InstancesOffset { get; init; }
+        public long LightsOffset { get; init; }
+        public Camera Camera { get; init; }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+namespace PathTracer.Core;
+
+public readonly record struct Tile
+{
+    public int X { get; init; }
+    public int Y { get; init; }
+    public int Width { get; init; }
+    public int Height { get; init; }
+
+    public int PixelCount => Width * Height;
+}
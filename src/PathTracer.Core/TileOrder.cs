@@ -0,0 +1,8 @@
+namespace PathTracer.Core;
+
+public enum TileOrder
+{
+    Scanline,
+    Morton,
+    Spiral
+}
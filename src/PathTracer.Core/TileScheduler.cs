@@ -0,0 +1,199 @@
+namespace PathTracer.Core;
+
+public static class TileScheduler
+{
+    // NOTE: Each worker queue is padded to its own cache line to avoid false sharing
+    private const int QueueStride = 8;
+
+    public static Tile[] CreateTiles(int width, int height, int tileSize, TileOrder tileOrder)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(width);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(height);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(tileSize);
+
+        var tileCountX = (width + tileSize - 1) / tileSize;
+        var tileCountY = (height + tileSize - 1) / tileSize;
+        var tiles = new Tile[tileCountX * tileCountY];
+        var sortKeys = new long[tiles.Length];
+
+        for (var tileY = 0; tileY < tileCountY; tileY++)
+        {
+            for (var tileX = 0; tileX < tileCountX; tileX++)
+            {
+                var tileIndex = tileY * tileCountX + tileX;
+
+                tiles[tileIndex] = new Tile
+                {
+                    X = tileX * tileSize,
+                    Y = tileY * tileSize,
+                    Width = Math.Min(tileSize, width - tileX * tileSize),
+                    Height = Math.Min(tileSize, height - tileY * tileSize)
+                };
+
+                sortKeys[tileIndex] = tileOrder switch
+                {
+                    TileOrder.Morton => GetMortonCode(tileX, tileY),
+                    TileOrder.Spiral => GetSpiralKey(tileX, tileY, tileCountX, tileCountY),
+                    _ => tileIndex
+                };
+            }
+        }
+
+        if (tileOrder != TileOrder.Scanline)
+        {
+            Array.Sort(sortKeys, tiles);
+        }
+
+        return tiles;
+    }
+
+    // NOTE: Every worker starts with a contiguous range of the ordered tiles so neighbouring
+    // tiles stay on the same core. When a worker runs out of tiles it steals the second half
+    // of the remaining range of another worker. Cancellation is checked before every tile.
+    public static void Run<TState>(Tile[] tiles, int workerCount, Func<TState> createWorkerState, Action<Tile, TState> renderTile, CancellationToken cancellationToken)
+    {
+        Run(tiles, workerCount, createWorkerState, renderTile, _ => { }, cancellationToken);
+    }
+
+    // NOTE: releaseWorkerState is called when a worker stops, even when a tile failed, so
+    // worker states can be reused by the next run
+    public static void Run<TState>(Tile[] tiles, int workerCount, Func<TState> createWorkerState, Action<Tile, TState> renderTile, Action<TState> releaseWorkerState, CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(tiles);
+        ArgumentNullException.ThrowIfNull(createWorkerState);
+        ArgumentNullException.ThrowIfNull(renderTile);
+        ArgumentNullException.ThrowIfNull(releaseWorkerState);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(workerCount);
+
+        cancellationToken.ThrowIfCancellationRequested();
+
+        if (tiles.Length == 0)
+        {
+            return;
+        }
+
+        workerCount = Math.Min(workerCount, tiles.Length);
+        var queues = new long[workerCount * QueueStride];
+
+        for (var i = 0; i < workerCount; i++)
+        {
+            queues[i * QueueStride] = PackRange((int)((long)tiles.Length * i / workerCount), (int)((long)tiles.Length * (i + 1) / workerCount));
+        }
+
+        Parallel.For(0, workerCount, new ParallelOptions { MaxDegreeOfParallelism = workerCount }, workerIndex =>
+        {
+            var workerState = createWorkerState();
+
+            try
+            {
+                while (!cancellationToken.IsCancellationRequested && (TryPop(queues, workerIndex, out var tileIndex) || TrySteal(queues, workerIndex, workerCount, out tileIndex)))
+                {
+                    renderTile(tiles[tileIndex], workerState);
+                }
+            }
+            finally
+            {
+                releaseWorkerState(workerState);
+            }
+        });
+
+        cancellationToken.ThrowIfCancellationRequested();
+    }
+
+    private static bool TryPop(long[] queues, int workerIndex, out int tileIndex)
+    {
+        ref var queue = ref queues[workerIndex * QueueStride];
+
+        while (true)
+        {
+            var range = Volatile.Read(ref queue);
+            var (start, end) = UnpackRange(range);
+
+            if (start >= end)
+            {
+                tileIndex = -1;
+                return false;
+            }
+
+            if (Interlocked.CompareExchange(ref queue, PackRange(start + 1, end), range) == range)
+            {
+                tileIndex = start;
+                return true;
+            }
+        }
+    }
+
+    private static bool TrySteal(long[] queues, int workerIndex, int workerCount, out int tileIndex)
+    {
+        for (var i = 1; i < workerCount; i++)
+        {
+            ref var victimQueue = ref queues[(workerIndex + i) % workerCount * QueueStride];
+
+            while (true)
+            {
+                var range = Volatile.Read(ref victimQueue);
+                var (start, end) = UnpackRange(range);
+
+                if (start >= end)
+                {
+                    break;
+                }
+
+                var stealCount = (end - start + 1) / 2;
+                var stealStart = end - stealCount;
+
+                if (Interlocked.CompareExchange(ref victimQueue, PackRange(start, stealStart), range) == range)
+                {
+                    // The local queue is empty at this point so thieves cannot race with this write
+                    Interlocked.Exchange(ref queues[workerIndex * QueueStride], PackRange(stealStart + 1, end));
+
+                    tileIndex = stealStart;
+                    return true;
+                }
+            }
+        }
+
+        tileIndex = -1;
+        return false;
+    }
+
+    private static long PackRange(int start, int end)
+    {
+        return ((long)end << 32) | (uint)start;
+    }
+
+    private static (int Start, int End) UnpackRange(long range)
+    {
+        return ((int)range, (int)(range >> 32));
+    }
+
+    private static long GetMortonCode(int x, int y)
+    {
+        return (long)(SpreadBits((uint)x) | (SpreadBits((uint)y) << 1));
+    }
+
+    private static ulong SpreadBits(uint value)
+    {
+        ulong result = value;
+
+        result = (result | (result << 16)) & 0x0000FFFF0000FFFF;
+        result = (result | (result << 8)) & 0x00FF00FF00FF00FF;
+        result = (result | (result << 4)) & 0x0F0F0F0F0F0F0F0F;
+        result = (result | (result << 2)) & 0x3333333333333333;
+        result = (result | (result << 1)) & 0x5555555555555555;
+
+        return result;
+    }
+
+    // NOTE: Tiles are sorted by ring around the center of the image, then by angle inside the ring
+    private static long GetSpiralKey(int x, int y, int tileCountX, int tileCountY)
+    {
+        var deltaX = x - (tileCountX - 1) * 0.5f;
+        var deltaY = y - (tileCountY - 1) * 0.5f;
+
+        var ring = (long)MathF.Max(MathF.Abs(deltaX), MathF.Abs(deltaY));
+        var angle = MathF.Atan2(deltaY, deltaX) + MathF.PI;
+
+        return (ring << 32) | (uint)(angle / (2.0f * MathF.PI) * int.MaxValue);
+    }
+}
@@ -0,0 +1,125 @@
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core;
+
+// NOTE: Converts linear HDR pixels to gamma corrected RGBA8 pixels packed as R | G << 8 | B << 16 | A << 24.
+// Every block of Vector<float>.Count pixels is converted with 4 vectors that are narrowed to one byte vector.
+public static class ToneMapping
+{
+    private const float GammaCorrection = 1.0f / 2.2f;
+    private const float MinimumValue = 1e-7f;
+
+    private static readonly Vector<float> _alphaMask = CreateAlphaMask();
+
+    public static int BlockPixelCount => Vector<float>.Count;
+
+    public static void ResolveToRgba8(ReadOnlySpan<Vector4> source, float scale, Span<uint> destination, ToneMappingOperator toneMappingOperator)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(destination.Length, source.Length, nameof(destination));
+
+        var sourceFloats = MemoryMarshal.Cast<Vector4, float>(source);
+        var destinationBytes = MemoryMarshal.AsBytes(destination);
+        var pixelIndex = 0;
+
+        for (; pixelIndex + BlockPixelCount <= source.Length; pixelIndex += BlockPixelCount)
+        {
+            ResolveBlock(sourceFloats[(pixelIndex * 4)..], scale, destinationBytes[(pixelIndex * 4)..], toneMappingOperator);
+        }
+
+        // The remaining pixels are converted with a padded block so the result matches the vector path
+        var remainingCount = source.Length - pixelIndex;
+
+        if (remainingCount > 0)
+        {
+            Span<Vector4> blockSource = stackalloc Vector4[BlockPixelCount];
+            Span<uint> blockDestination = stackalloc uint[BlockPixelCount];
+
+            blockSource.Clear();
+            source[pixelIndex..].CopyTo(blockSource);
+
+            ResolveBlock(MemoryMarshal.Cast<Vector4, float>(blockSource), scale, MemoryMarshal.AsBytes(blockDestination), toneMappingOperator);
+            blockDestination[..remainingCount].CopyTo(destination[pixelIndex..]);
+        }
+    }
+
+    private static void ResolveBlock(ReadOnlySpan<float> source, float scale, Span<byte> destination, ToneMappingOperator toneMappingOperator)
+    {
+        var vectorSize = Vector<float>.Count;
+
+        var pixels0 = ResolveVector(new Vector<float>(source), scale, toneMappingOperator);
+        var pixels1 = ResolveVector(new Vector<float>(source[vectorSize..]), scale, toneMappingOperator);
+        var pixels2 = ResolveVector(new Vector<float>(source[(vectorSize * 2)..]), scale, toneMappingOperator);
+        var pixels3 = ResolveVector(new Vector<float>(source[(vectorSize * 3)..]), scale, toneMappingOperator);
+
+        var bytes = Vector.Narrow(Vector.Narrow(pixels0, pixels1), Vector.Narrow(pixels2, pixels3));
+        bytes.CopyTo(destination);
+    }
+
+    private static Vector<uint> ResolveVector(Vector<float> value, float scale, ToneMappingOperator toneMappingOperator)
+    {
+        value = Vector.Max(value * scale, Vector<float>.Zero);
+
+        var color = toneMappingOperator switch
+        {
+            ToneMappingOperator.Reinhard => value / (Vector<float>.One + value),
+            ToneMappingOperator.Aces => Vector.Min(value * (value * 2.51f + new Vector<float>(0.03f)) / (value * (value * 2.43f + new Vector<float>(0.59f)) + new Vector<float>(0.14f)), Vector<float>.One),
+            _ => Vector.Min(value, Vector<float>.One)
+        };
+
+        color = Pow(Vector.Max(color, new Vector<float>(MinimumValue)), GammaCorrection);
+
+        // Alpha is stored without tone mapping and gamma correction
+        var result = Vector.ConditionalSelect(_alphaMask, Vector.Min(value, Vector<float>.One), color);
+        return Vector.ConvertToUInt32(Vector.Min(result * 255.0f + new Vector<float>(0.5f), new Vector<float>(255.0f)));
+    }
+
+    // NOTE: Fast approximation of pow(x, y) = exp2(y * log2(x)) for x > 0. Polynomials are
+    // Chebyshev fits with a maximum error of 2e-5 for log2 and 4e-6 for exp2.
+    private static Vector<float> Pow(Vector<float> value, float exponent)
+    {
+        return Exp2(Log2(value) * exponent);
+    }
+
+    private static Vector<float> Log2(Vector<float> value)
+    {
+        var bits = Vector.AsVectorInt32(value);
+        var exponent = Vector.ConvertToSingle((Vector.ShiftRightLogical(bits, 23) & new Vector<int>(0xFF)) - new Vector<int>(127));
+        var mantissa = Vector.AsVectorSingle((bits & new Vector<int>(0x007FFFFF)) | new Vector<int>(0x3F800000));
+
+        var result = new Vector<float>(0.043004958f);
+        result = result * mantissa + new Vector<float>(-0.40251339f);
+        result = result * mantissa + new Vector<float>(1.5894743f);
+        result = result * mantissa + new Vector<float>(-3.4898786f);
+        result = result * mantissa + new Vector<float>(5.0478554f);
+        result = result * mantissa + new Vector<float>(-2.7879262f);
+
+        return result + exponent;
+    }
+
+    private static Vector<float> Exp2(Vector<float> value)
+    {
+        var integerPart = Vector.Floor(value);
+        var fractionalPart = value - integerPart;
+
+        var result = new Vector<float>(0.013670309f);
+        result = result * fractionalPart + new Vector<float>(0.051744998f);
+        result = result * fractionalPart + new Vector<float>(0.24160436f);
+        result = result * fractionalPart + new Vector<float>(0.69297292f);
+        result = result * fractionalPart + new Vector<float>(1.0000035f);
+
+        var scale = Vector.AsVectorSingle(Vector.ShiftLeft(Vector.ConvertToInt32(integerPart) + new Vector<int>(127), 23));
+        return result * scale;
+    }
+
+    private static Vector<float> CreateAlphaMask()
+    {
+        Span<int> mask = stackalloc int[Vector<float>.Count];
+
+        for (var i = 0; i < mask.Length; i++)
+        {
+            mask[i] = i % 4 == 3 ? -1 : 0;
+        }
+
+        return Vector.AsVectorSingle(new Vector<int>(mask));
+    }
+}
@@ -20,6 +20,7 @@ public interface IGraphicsService
     void UpdateBuffer<T>(GraphicsBuffer buffer, nuint offset, ReadOnlySpan<T> data) where T : unmanaged;
 
     Texture CreateTexture(GraphicsDevice graphicsDevice, int width, int height, int depth, int mipLevels, int arrayLayers, TextureFormat format, TextureUsage usage, TextureType type);
+    void DeleteTexture(Texture texture);
     void UpdateTexture<T>(Texture texture, ReadOnlySpan<T> data) where T : unmanaged;
 
     Shader CreateShader(GraphicsDevice graphicsDevice, ReadOnlySpan<byte> byteCode);
@@ -27,6 +28,7 @@ public interface IGraphicsService
     ResourceLayout CreateResourceLayout(GraphicsDevice graphicsDevice, ReadOnlySpan<ResourceLayoutElement> elements);
     ResourceSet CreateResourceSet(ResourceLayout resourceLayout, GraphicsBuffer buffer);
     ResourceSet CreateResourceSet(ResourceLayout resourceLayout, Texture texture);
+    void DeleteResourceSet(ResourceSet resourceSet);
 
     PipelineState CreatePipelineState(GraphicsDevice graphicsDevice, Shader shader, ReadOnlySpan<ResourceLayout> layouts);
 
@@ -13,11 +13,17 @@ public class VeldridGraphicsService : IGraphicsService
     private readonly IList<VeldridCommandList> _commandLists;
     private readonly IList<VeldridShader> _shaders;
     private readonly IList<VeldridBuffer> _buffers;
-    private readonly IList<VeldridTexture> _textures;
     private readonly IList<Veldrid.ResourceLayout> _layouts;
-    private readonly IList<Veldrid.ResourceSet> _resourceSets;
     private readonly IList<VeldridPipeline> _pipelines;
 
+    // NOTE: Textures and resource sets are deleted when the render images are resized, their
+    // handles are never reused so a handle kept after a delete cannot reach a newer resource
+    private readonly IDictionary<nint, VeldridTexture> _textures;
+    private readonly IDictionary<nint, VeldridResourceSet> _resourceSets;
+    private nint _lastTextureHandle;
+    private nint _lastResourceSetHandle;
+    private bool _hasDeferredDisposals;
+
     public VeldridGraphicsService(INativeUIService nativeUIService)
     {
         _nativeUIService = nativeUIService;
@@ -25,10 +31,10 @@ public class VeldridGraphicsService : IGraphicsService
         _commandLists = new List<VeldridCommandList>();
         _shaders = new List<VeldridShader>();
         _buffers = new List<VeldridBuffer>();
-        _textures = new List<VeldridTexture>();
         _layouts = new List<Veldrid.ResourceLayout>();
-        _resourceSets = new List<Veldrid.ResourceSet>();
         _pipelines = new List<VeldridPipeline>();
+        _textures = new Dictionary<nint, VeldridTexture>();
+        _resourceSets = new Dictionary<nint, VeldridResourceSet>();
     }
 
     public GraphicsLegacy.GraphicsDevice CreateDevice(NativeWindow window)
@@ -104,6 +110,14 @@ public class VeldridGraphicsService : IGraphicsService
     
     
         veldridGraphicsDevice.SwapBuffers(veldridGraphicsDevice.MainSwapchain);
+
+        // NOTE: Deleted resources can still be used by the frame that was just presented, Veldrid
+        // only destroys them when waiting for the device so the wait is done only when needed
+        if (_hasDeferredDisposals)
+        {
+            _hasDeferredDisposals = false;
+            veldridGraphicsDevice.WaitForIdle();
+        }
     }
 
     public GraphicsLegacy.CommandList CreateCommandList(GraphicsLegacy.GraphicsDevice graphicsDevice)
@@ -152,6 +166,7 @@ public class VeldridGraphicsService : IGraphicsService
         // TODO: For the moment we don't delete the struct in the list
         var veldridBuffer = _buffers[ToIndex(buffer)];
         veldridBuffer.GraphicsDevice.DisposeWhenIdle(veldridBuffer.Buffer);
+        _hasDeferredDisposals = true;
     }
 
     public GraphicsBufferDescription GetBufferDescription(GraphicsBuffer buffer)
@@ -178,19 +193,36 @@ public class VeldridGraphicsService : IGraphicsService
         var texture = veldridGraphicsDevice.ResourceFactory.CreateTexture(new TextureDescription((uint)width, (uint)height, (uint)depth, (uint)mipLevels, (uint)arrayLayers, (PixelFormat)(byte)format, (Veldrid.TextureUsage)(byte)usage, (Veldrid.TextureType)type));
         var textureView = usage == GraphicsLegacy.TextureUsage.Sampled ? veldridGraphicsDevice.ResourceFactory.CreateTextureView(texture) : null;
         
-        _textures.Add(new VeldridTexture
+        _lastTextureHandle++;
+        _textures.Add(_lastTextureHandle, new VeldridTexture
         {
             Texture = texture,
             TextureView = textureView,
             GraphicsDevice = veldridGraphicsDevice
         });
 
-        return _textures.Count;
+        return _lastTextureHandle;
+    }
+
+    public void DeleteTexture(GraphicsLegacy.Texture texture)
+    {
+        if (!_textures.Remove(texture, out var veldridTexture))
+        {
+            throw new ArgumentException("Texture was already deleted.", nameof(texture));
+        }
+
+        if (veldridTexture.TextureView != null)
+        {
+            veldridTexture.GraphicsDevice.DisposeWhenIdle(veldridTexture.TextureView);
+        }
+
+        veldridTexture.GraphicsDevice.DisposeWhenIdle(veldridTexture.Texture);
+        _hasDeferredDisposals = true;
     }
 
     public void UpdateTexture<T>(GraphicsLegacy.Texture texture, ReadOnlySpan<T> data) where T : unmanaged
     {
-        var veldridTexture = _textures[ToIndex(texture)];
+        var veldridTexture = _textures[texture];
         veldridTexture.GraphicsDevice.UpdateTexture(veldridTexture.Texture, data, 0, 0, 0, veldridTexture.Texture.Width, veldridTexture.Texture.Height, 1, 0, 0);
     }
 
@@ -251,13 +283,14 @@ public class VeldridGraphicsService : IGraphicsService
         // with unbound resources.
         var resourceSet = graphicsDevice.ResourceFactory.CreateResourceSet(new ResourceSetDescription(layout, veldridBuffer.Buffer, graphicsDevice.PointSampler));
         
-        _resourceSets.Add(resourceSet);
-        return _resourceSets.Count;
+        _lastResourceSetHandle++;
+        _resourceSets.Add(_lastResourceSetHandle, new VeldridResourceSet { ResourceSet = resourceSet, GraphicsDevice = graphicsDevice });
+        return _lastResourceSetHandle;
     }
     
     public GraphicsLegacy.ResourceSet CreateResourceSet(GraphicsLegacy.ResourceLayout resourceLayout, GraphicsLegacy.Texture texture)
     {
-        var veldridTexture = _textures[ToIndex(texture)];
+        var veldridTexture = _textures[texture];
         var layout = _layouts[ToIndex(resourceLayout)];
         var graphicsDevice = veldridTexture.GraphicsDevice;
 
@@ -266,8 +299,20 @@ public class VeldridGraphicsService : IGraphicsService
         // with unbound resources.
         var resourceSet = graphicsDevice.ResourceFactory.CreateResourceSet(new ResourceSetDescription(layout, veldridTexture.TextureView));
         
-        _resourceSets.Add(resourceSet);
-        return _resourceSets.Count;
+        _lastResourceSetHandle++;
+        _resourceSets.Add(_lastResourceSetHandle, new VeldridResourceSet { ResourceSet = resourceSet, GraphicsDevice = graphicsDevice });
+        return _lastResourceSetHandle;
+    }
+
+    public void DeleteResourceSet(GraphicsLegacy.ResourceSet resourceSet)
+    {
+        if (!_resourceSets.Remove(resourceSet, out var veldridResourceSet))
+        {
+            throw new ArgumentException("Resource set was already deleted.", nameof(resourceSet));
+        }
+
+        veldridResourceSet.GraphicsDevice.DisposeWhenIdle(veldridResourceSet.ResourceSet);
+        _hasDeferredDisposals = true;
     }
 
     public PipelineState CreatePipelineState(GraphicsLegacy.GraphicsDevice graphicsDevice, GraphicsLegacy.Shader shader, ReadOnlySpan<GraphicsLegacy.ResourceLayout> layouts)
@@ -328,8 +373,8 @@ public class VeldridGraphicsService : IGraphicsService
     public void CopyTexture(GraphicsLegacy.CommandList commandList, GraphicsLegacy.Texture source, GraphicsLegacy.Texture destination)
     {
         var veldridCommandList = _commandLists[ToIndex(commandList)];
-        var sourceVeldridTexture = _textures[ToIndex(source)];
-        var destinationVeldridTexture = _textures[ToIndex(destination)];
+        var sourceVeldridTexture = _textures[source];
+        var destinationVeldridTexture = _textures[destination];
 
         veldridCommandList.CommandList.CopyTexture(sourceVeldridTexture.Texture, destinationVeldridTexture.Texture);
     }
@@ -361,9 +406,9 @@ public class VeldridGraphicsService : IGraphicsService
     public void SetResourceSet(GraphicsLegacy.CommandList commandList, int slot, GraphicsLegacy.ResourceSet resourceSet)
     {
         var veldridCommandList = _commandLists[ToIndex(commandList)];
-        var veldridResourceSet = _resourceSets[ToIndex(resourceSet)];
+        var veldridResourceSet = _resourceSets[resourceSet];
 
-        veldridCommandList.CommandList.SetGraphicsResourceSet((uint)slot, veldridResourceSet);
+        veldridCommandList.CommandList.SetGraphicsResourceSet((uint)slot, veldridResourceSet.ResourceSet);
     }
     
     public void SetScissorRect(GraphicsLegacy.CommandList commandList, int x, int y, int width, int height)
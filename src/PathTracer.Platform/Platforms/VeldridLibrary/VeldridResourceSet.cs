@@ -0,0 +1,9 @@
+using Veldrid;
+
+namespace PathTracer.Platform.Platforms.VeldridLibrary;
+
+public record VeldridResourceSet
+{
+    public required ResourceSet ResourceSet { get; init; }
+    public required GraphicsDevice GraphicsDevice { get; init; }
+}
\ No newline at end of file
@@ -17,13 +17,14 @@ internal unsafe class ImGuiRenderer : BaseRenderer, IDisposable
 
     private readonly ResourceSet _mainResourceSet;
     private readonly ResourceSet _fontTextureResourceSet;
-    private readonly IList<ResourceSet> _textureResourceSets;
+    private readonly IDictionary<nint, ResourceSet> _textureResourceSets;
 
     private readonly nint _fontAtlasID;
     private readonly uint _vertexSizeInBytes;
 
     private GraphicsBuffer _vertexBuffer;
     private GraphicsBuffer _indexBuffer;
+    private nint _lastTextureId;
     
     public ImGuiRenderer(IGraphicsService graphicsService, GraphicsDevice graphicsDevice, string? fontName) : base(graphicsService, graphicsDevice)
     {
@@ -31,7 +32,8 @@ internal unsafe class ImGuiRenderer : BaseRenderer, IDisposable
 
         _fontAtlasID = 1;
         _vertexSizeInBytes = (uint)Unsafe.SizeOf<ImDrawVert>();
-        _textureResourceSets = new List<ResourceSet>();
+        _textureResourceSets = new Dictionary<nint, ResourceSet>();
+        _lastTextureId = _fontAtlasID;
 
         _vertexBuffer = GraphicsService.CreateBuffer(GraphicsDevice, 10000, GraphicsBufferUsage.VertexBuffer | GraphicsBufferUsage.Dynamic);
         _indexBuffer = GraphicsService.CreateBuffer(GraphicsDevice, 2000, GraphicsBufferUsage.IndexBuffer | GraphicsBufferUsage.Dynamic);
@@ -80,17 +82,27 @@ internal unsafe class ImGuiRenderer : BaseRenderer, IDisposable
     public nint RegisterTexture(Texture texture)
     {
         var textureResourceSet = GraphicsService.CreateResourceSet(_textureLayout, texture);
-        _textureResourceSets.Add(textureResourceSet);
-        return _textureResourceSets.Count + 1;
+        _textureResourceSets.Add(++_lastTextureId, textureResourceSet);
+        return _lastTextureId;
+    }
+
+    public void UnregisterTexture(nint id)
+    {
+        if (!_textureResourceSets.Remove(id, out var textureResourceSet))
+        {
+            throw new ArgumentException("Texture was not registered.", nameof(id));
+        }
+
+        GraphicsService.DeleteResourceSet(textureResourceSet);
     }
 
     public void UpdateTexture(nint id, Texture texture)
     {
-        var oldResourceSet = _textureResourceSets[(int)id - 2];
-        //GraphicsDevice.DisposeWhenIdle(oldResourceSet);
+        var oldResourceSet = _textureResourceSets[id];
+        GraphicsService.DeleteResourceSet(oldResourceSet);
 
         var textureResourceSet = GraphicsService.CreateResourceSet(_textureLayout, texture);
-        _textureResourceSets[(int)id - 2] = textureResourceSet;
+        _textureResourceSets[id] = textureResourceSet;
     }
 
     public void RenderImDrawData(CommandList commandList, ref ImDrawDataPtr drawData)
@@ -153,7 +165,7 @@ internal unsafe class ImGuiRenderer : BaseRenderer, IDisposable
                     }
                     else
                     {
-                        GraphicsService.SetResourceSet(commandList, 1, _textureResourceSets[(int)drawCommand.TextureId - 2]);
+                        GraphicsService.SetResourceSet(commandList, 1, _textureResourceSets[drawCommand.TextureId]);
                     }
                 }
 
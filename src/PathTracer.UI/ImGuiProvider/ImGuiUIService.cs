@@ -12,6 +12,7 @@ public class ImGuiUIService : IUIService
     private readonly IGraphicsService _graphicsService;
 
     private readonly IDictionary<Texture, nint> _textureIdList;
+    private readonly HashSet<Texture> _drawnTextures;
 
     private ImGuiBackend? _imGuiBackend;
     private ImGuiRenderer? _imGuiRenderer;
@@ -23,6 +24,7 @@ public class ImGuiUIService : IUIService
         _graphicsService = graphicsService;
 
         _textureIdList = new Dictionary<Texture, nint>();
+        _drawnTextures = new HashSet<Texture>();
     }
 
     public void Init(NativeWindow window, GraphicsDevice graphicsDevice)
@@ -90,6 +92,8 @@ public class ImGuiUIService : IUIService
         _graphicsService.ResetCommandList(_commandList.Value);
         _imGuiRenderer.RenderImDrawData(_commandList.Value, ref imGuiDrawData);
         _graphicsService.SubmitCommandList(_commandList.Value);
+
+        RemoveUnusedTextureIds(_imGuiRenderer);
     }
 
     public bool BeginPanel(string title, PanelStyles panelStyles)
@@ -169,14 +173,13 @@ public class ImGuiUIService : IUIService
             throw new InvalidOperationException("You need call the init method first.");
         }
 
-        // TODO: We need a way to clean the unused ids
-        if (!_textureIdList.ContainsKey(texture))
+        if (!_textureIdList.TryGetValue(texture, out var textureId))
         {
-            var id = _imGuiRenderer.RegisterTexture(texture);
-            _textureIdList.Add(texture, id);
+            textureId = _imGuiRenderer.RegisterTexture(texture);
+            _textureIdList.Add(texture, textureId);
         }
 
-        var textureId = _textureIdList[texture];
+        _drawnTextures.Add(texture);
         ImGui.Image(textureId, new Vector2(width, height));
     }
 
@@ -243,4 +246,17 @@ public class ImGuiUIService : IUIService
     {
         ImGui.ProgressBar(value, new Vector2(0.0f, 0.0f));
     }
+
+    // NOTE: Textures are deleted when the render images are resized and their handles are never
+    // reused, so the ids of the textures that were not drawn during the frame are released
+    private void RemoveUnusedTextureIds(ImGuiRenderer imGuiRenderer)
+    {
+        foreach (var texture in _textureIdList.Keys.Where(item => !_drawnTextures.Contains(item)).ToList())
+        {
+            imGuiRenderer.UnregisterTexture(_textureIdList[texture]);
+            _textureIdList.Remove(texture);
+        }
+
+        _drawnTextures.Clear();
+    }
 }
\ No newline at end of file
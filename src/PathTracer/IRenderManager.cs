@@ -6,9 +6,10 @@ public interface IRenderManager
     int FileRenderingProgression { get; }
     DateTime LastRenderTime { get; }
     long RenderDuration { get; }
+    RenderCounterValues RenderCounters { get; }
 
     void CreateRenderTextures(GraphicsDevice graphicsDevice, int width, int height);
-    void RenderScene(CommandList commandList, Scene scene, Camera camera);
+    void RenderScene(CommandList commandList, Scene scene, Camera camera, RenderOptions renderOptions);
     void RenderToImage(RenderSettings renderSettings, Scene scene, Camera camera);
     void CheckRenderToImageErrors();
 }
@@ -2,6 +2,8 @@ namespace PathTracer;
 
 public interface IUIManager
 {
+    RenderOptions RenderOptions { get; }
+
     void Init(NativeWindow window, GraphicsDevice graphicsDevice);
     void Resize(NativeWindowSize windowSize);
     Vector2 Update(float deltaTime, InputState inputState, TextureImage renderImage, RenderStatistics renderStatistics, Scene scene);
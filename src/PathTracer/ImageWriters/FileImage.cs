@@ -6,13 +6,11 @@ public record struct FileImage : IImage
     {
         Width = 0;
         Height = 0;
-        ImageData = Array.Empty<Vector4>();
-        AccumulationData = Array.Empty<Vector4>();
+        AccumulationBuffer = new AccumulationBuffer(0, 0);
     }
 
     public int Width { get; init; }
     public int Height { get; init; }
-    public Memory<Vector4> ImageData { get; init; }
-    public Memory<Vector4> AccumulationData { get; init; }
-    public int FrameCount { get; set; }
+    public AccumulationBuffer AccumulationBuffer { get; init; }
+    public ToneMappingOperator ToneMappingOperator { get; init; }
 }
\ No newline at end of file
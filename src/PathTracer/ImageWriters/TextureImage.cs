@@ -9,7 +9,7 @@ public record struct TextureImage : IImage
         CpuTexture = new Texture();
         GpuTexture = new Texture();
         ImageData = Array.Empty<uint>();
-        AccumulationData = Array.Empty<Vector4>();
+        AccumulationBuffer = new AccumulationBuffer(0, 0);
     }
 
     public int Width { get; init; }
@@ -17,6 +17,6 @@ public record struct TextureImage : IImage
     public Texture CpuTexture { get; init; }
     public Texture GpuTexture { get; init; }
     public Memory<uint> ImageData { get; init; }
-    public Memory<Vector4> AccumulationData { get; init; }
-    public int FrameCount { get; set; }
+    public AccumulationBuffer AccumulationBuffer { get; init; }
+    public ToneMappingOperator ToneMappingOperator { get; init; }
 }
\ No newline at end of file
@@ -18,8 +18,10 @@ public class PathTracerApplication
     private readonly GraphicsDevice _graphicsDevice;
     private readonly CommandList _commandList;
     private readonly FrameTimer _frameTimer;
+    private readonly Stopwatch _renderCountersStopwatch;
 
     private RenderStatistics _renderStatistics;
+    private RenderCounterValues _renderCounters;
     private NativeApplicationStatus _appStatus;
     private InputState _inputState;
     private NativeWindowSize _currentWindowSize;
@@ -50,6 +52,7 @@ public class PathTracerApplication
         
         _renderStatistics = new RenderStatistics();
         _frameTimer = new FrameTimer();
+        _renderCountersStopwatch = Stopwatch.StartNew();
         _appStatus = new NativeApplicationStatus();
         _inputState = new InputState();
 
@@ -73,7 +76,8 @@ public class PathTracerApplication
         _scene.Materials.Add(new Material()
         {
             Albedo = new Vector3(1.0f, 1.0f, 0.0f),
-            Roughness = 0.0f
+            Roughness = 0.0f,
+            Metallic = 1.0f
         });
         
         _scene.Materials.Add(new Material()
@@ -96,6 +100,12 @@ public class PathTracerApplication
             MaterialIndex = 1
         });
 
+        _scene.Lights.Add(new Light()
+        {
+            Direction = new Vector3(1.0f, -1.0f, 1.0f),
+            Intensity = 3.0f
+        });
+
         _commandManager.RegisterCommandHandler<RenderCommand>((renderCommand) => _renderManager.RenderToImage(renderCommand.RenderSettings, _scene, _camera));
     }
 
@@ -111,15 +121,12 @@ public class PathTracerApplication
             _inputService.UpdateInputState(_nativeApplication, ref _inputState);
             _camera = UpdateCamera(_camera, _inputState, _frameTimer.DeltaTime);
 
-            // TODO: Temporary
-            _scene.HasChanged = false;
-
             var availableViewportSize = _uiManager.Update(_frameTimer.DeltaTime, _inputState, _renderManager.CurrentTextureImage, _renderStatistics, _scene);
             _commandManager.Update();
 
             CreateRenderTexturesIfNeeded(windowSize, availableViewportSize);
 
-            _renderManager.RenderScene(_commandList, _scene, _camera);
+            _renderManager.RenderScene(_commandList, _scene, _camera, _uiManager.RenderOptions);
             _uiManager.Render();
             _graphicsService.PresentSwapChain(_graphicsDevice);
 
@@ -175,7 +182,30 @@ public class PathTracerApplication
         _renderStatistics.CpuUsage = _frameTimer.CpuUsage;
         _renderStatistics.GCGen0Count = GC.CollectionCount(0);
         _renderStatistics.GCGen1Count = GC.CollectionCount(1);
-        _renderStatistics.GCGen0Count = GC.CollectionCount(2);
+        _renderStatistics.GCGen2Count = GC.CollectionCount(2);
+
+        // NOTE: Render counters are sampled once per second, stage times are the worker time
+        // spent in each stage during the last second
+        if (_renderCountersStopwatch.ElapsedMilliseconds >= 1000)
+        {
+            var renderCounters = _renderManager.RenderCounters;
+            var deltaCounters = renderCounters.Subtract(_renderCounters);
+            var elapsedSeconds = _renderCountersStopwatch.Elapsed.TotalSeconds;
+
+            _renderStatistics.RaysPerSecond = (long)(deltaCounters.RayCount / elapsedSeconds);
+            _renderStatistics.ShadowRaysPerSecond = (long)(deltaCounters.ShadowRayCount / elapsedSeconds);
+            _renderStatistics.SamplesPerSecond = (long)(deltaCounters.SampleCount / elapsedSeconds);
+            _renderStatistics.BouncesPerPath = (float)deltaCounters.BouncesPerPath;
+            _renderStatistics.RussianRouletteRatio = (float)deltaCounters.RussianRouletteRatio;
+            _renderStatistics.HitRatio = (float)deltaCounters.HitRatio;
+            _renderStatistics.IntersectionTestsPerRay = (float)deltaCounters.IntersectionTestsPerRay;
+            _renderStatistics.RenderStageTime = (float)deltaCounters.RenderTime.TotalMilliseconds;
+            _renderStatistics.AccumulateStageTime = (float)deltaCounters.AccumulateTime.TotalMilliseconds;
+            _renderStatistics.ConvergenceStageTime = (float)deltaCounters.ConvergenceTime.TotalMilliseconds;
+
+            _renderCounters = renderCounters;
+            _renderCountersStopwatch.Restart();
+        }
     }
 
     // TODO: To be converted to an ECS System
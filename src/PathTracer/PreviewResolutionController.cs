@@ -0,0 +1,101 @@
+namespace PathTracer;
+
+// NOTE: Picks the resolution of the interactive preview from the measured render time. The
+// time per pixel sample of the previous renders is used to predict the time of each preview
+// level. While the camera moves the largest level that fits in the frame budget is rendered,
+// with more samples when there is time left. Once the camera is idle the levels are stepped
+// up one at a time until the full resolution pass takes over, a level that cannot fit in a
+// whole frame starts the full resolution pass directly since that pass doesn't block frames.
+public sealed class PreviewResolutionController
+{
+    public const int MaxSampleCount = 4;
+
+    private const double SmoothingFactor = 0.5;
+
+    private static readonly float[] _scaleRatios = [0.125f, 0.25f, 0.5f];
+
+    private readonly (int Width, int Height)[] _levelSizes;
+    private double _secondsPerPixelSample;
+
+    public PreviewResolutionController(TimeSpan frameBudget)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThanOrEqual(frameBudget, TimeSpan.Zero);
+
+        FrameBudget = frameBudget;
+        _levelSizes = new (int Width, int Height)[_scaleRatios.Length];
+    }
+
+    public TimeSpan FrameBudget { get; }
+    public int LevelCount => _scaleRatios.Length;
+
+    public void SetResolution(int width, int height)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(width);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(height);
+
+        var aspectRatio = (float)width / height;
+
+        for (var i = 0; i < _levelSizes.Length; i++)
+        {
+            var levelWidth = Math.Max((int)(width * _scaleRatios[i]), 1);
+            _levelSizes[i] = (levelWidth, Math.Max((int)(levelWidth / aspectRatio), 1));
+        }
+    }
+
+    public (int Width, int Height) GetLevelSize(int level)
+    {
+        return _levelSizes[level];
+    }
+
+    // NOTE: Renders of every size can be measured, the full resolution passes included
+    public void AddMeasurement(long pixelSampleCount, TimeSpan renderTime)
+    {
+        if (pixelSampleCount <= 0)
+        {
+            return;
+        }
+
+        var secondsPerPixelSample = renderTime.TotalSeconds / pixelSampleCount;
+
+        _secondsPerPixelSample = _secondsPerPixelSample == 0.0 ? secondsPerPixelSample : _secondsPerPixelSample + (secondsPerPixelSample - _secondsPerPixelSample) * SmoothingFactor;
+    }
+
+    public TimeSpan EstimateRenderTime(int level, int sampleCount)
+    {
+        var (width, height) = _levelSizes[level];
+        return TimeSpan.FromSeconds(_secondsPerPixelSample * width * height * sampleCount);
+    }
+
+    // NOTE: The first frames use the smallest level until a render was measured
+    public (int Level, int SampleCount) GetMotionFrame()
+    {
+        if (_secondsPerPixelSample > 0.0)
+        {
+            for (var level = LevelCount - 1; level >= 0; level--)
+            {
+                var renderTime = EstimateRenderTime(level, 1);
+
+                if (renderTime <= FrameBudget)
+                {
+                    var sampleCount = renderTime > TimeSpan.Zero ? (int)Math.Min(FrameBudget / renderTime, MaxSampleCount) : MaxSampleCount;
+                    return (level, sampleCount);
+                }
+            }
+        }
+
+        return (0, 1);
+    }
+
+    // NOTE: Returns the next level to render or LevelCount when the full resolution pass can start
+    public int GetIdleLevel(int level)
+    {
+        var nextLevel = level + 1;
+
+        if (nextLevel >= LevelCount)
+        {
+            return LevelCount;
+        }
+
+        return EstimateRenderTime(nextLevel, 1) > FrameBudget ? LevelCount : nextLevel;
+    }
+}
\ No newline at end of file
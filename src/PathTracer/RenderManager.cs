@@ -1,25 +1,45 @@
 namespace PathTracer;
 
-public class RenderManager : IRenderManager
+// NOTE: Interactive renders run on a dedicated render thread. The UI thread posts a render
+// request when the camera, the scene or the options change and the render thread produces
+// the preview levels then the full resolution passes of the latest request. Every frame is
+// resolved by the render thread into a slot of a triple buffer, the UI thread only uploads
+// the latest completed frame so its frame rate doesn't depend on the render cost. A new
+// request cancels the running refinement or full resolution pass after the tiles in flight.
+// Requests carry a snapshot of the scene so the UI thread keeps editing the scene while it
+// is rendered.
+public class RenderManager : IRenderManager, IDisposable
 {
-    private const float _lowResolutionScaleRatio = 0.25f;
+    private const int MaxFullResolutionFrameCount = 50;
+
+    private static readonly TimeSpan _previewFrameBudget = TimeSpan.FromMilliseconds(30);
 
     private readonly IGraphicsService _graphicsService;
     private readonly IRenderer<TextureImage, CommandList> _renderer;
     private readonly IRenderer<FileImage, string> _fileRenderer;
-
-    private readonly Stopwatch _renderStopwatch;
+    private readonly RenderBufferPool _bufferPool;
+    private readonly PreviewResolutionController _previewResolutionController;
+    private readonly TextureImage[] _previewTextureImages;
+    private readonly TripleBuffer<RenderFrame> _frames;
+    private readonly Denoiser _denoiser;
+    private readonly RenderMetrics _renderMetrics;
+
+    // NOTE: Held by the render thread while it renders, resizing takes it to swap the buffers
+    private readonly object _renderLock;
+    private readonly AutoResetEvent _renderRequestEvent;
+
+    private Thread? _renderThread;
+    private RenderRequest? _renderRequest;
+    private volatile bool _isStopping;
+    private bool _isRenderInvalidated;
 
     private Task? _fileRenderingTask;
-    private Task? _fullResolutionRenderingTask;
-    private bool _isFullResolutionRenderComplete = true;
-    private bool _computeNewHighRes;
-    private int _resetRenderFrameCount;
-    private int _renderFrameCount;
-
-    private TextureImage _textureImage;
     private TextureImage _fullResolutionTextureImage;
+    private AccumulationBuffer _denoisedAccumulationBuffer;
+    private TextureImage _currentTextureImage;
+    private Scene? _sceneSnapshot;
     private Camera _camera;
+    private RenderOptions _renderOptions;
 
     public RenderManager(IGraphicsService graphicsService,
                          IRenderer<TextureImage, CommandList> renderer,
@@ -28,167 +48,462 @@ public class RenderManager : IRenderManager
         _graphicsService = graphicsService;
         _renderer = renderer;
         _fileRenderer = fileRenderer;
+        _bufferPool = RenderBufferPool.Shared;
+        _previewResolutionController = new PreviewResolutionController(_previewFrameBudget);
+        _previewTextureImages = new TextureImage[_previewResolutionController.LevelCount];
+        Array.Fill(_previewTextureImages, new TextureImage());
+        _frames = new TripleBuffer<RenderFrame>(new RenderFrame(), new RenderFrame(), new RenderFrame());
+        _denoiser = new Denoiser(_bufferPool);
+        _denoisedAccumulationBuffer = new AccumulationBuffer(0, 0);
+
+        _renderLock = new object();
+        _renderRequestEvent = new AutoResetEvent(false);
 
         FileRenderingProgression = 100;
 
-        _renderStopwatch = new Stopwatch();
+        _renderMetrics = new RenderMetrics();
+        _renderMetrics.Add("interactive", renderer.Counters);
+        _renderMetrics.Add("file", fileRenderer.Counters);
+
+        _currentTextureImage = _previewTextureImages[0];
         _camera = new Camera();
+        _renderOptions = new RenderOptions();
     }
 
-    public TextureImage CurrentTextureImage => _renderFrameCount > 0 ? _fullResolutionTextureImage : _textureImage;
+    public TextureImage CurrentTextureImage => _currentTextureImage;
     public int FileRenderingProgression { get; private set; }
     public DateTime LastRenderTime { get; private set; }
     public long RenderDuration { get; private set; }
+    public RenderCounterValues RenderCounters => _renderer.Counters.GetValues();
 
     public void CreateRenderTextures(GraphicsDevice graphicsDevice, int width, int height)
     {
-        var aspectRatio = (float)width / height;
-        var lowResWidth = (int)(width * _lowResolutionScaleRatio);
-        var lowResHeight = (int)(lowResWidth / aspectRatio);
+        if (width == _fullResolutionTextureImage.Width && height == _fullResolutionTextureImage.Height)
+        {
+            return;
+        }
+
+        // NOTE: The running pass writes into the buffers that are released, it is canceled and
+        // the request is posted again with the new buffers on the next frame
+        _renderRequest?.CancellationTokenSource.Cancel();
+        _isRenderInvalidated = true;
 
-        _textureImage = CreateOrUpdateTextureImage(graphicsDevice, in _textureImage, lowResWidth, lowResHeight);
-        _fullResolutionTextureImage = CreateOrUpdateTextureImage(graphicsDevice, in _fullResolutionTextureImage, width, height);
+        lock (_renderLock)
+        {
+            _previewResolutionController.SetResolution(width, height);
+
+            for (var i = 0; i < _previewTextureImages.Length; i++)
+            {
+                var (previewWidth, previewHeight) = _previewResolutionController.GetLevelSize(i);
+                _previewTextureImages[i] = CreateOrUpdateTextureImage(graphicsDevice, in _previewTextureImages[i], previewWidth, previewHeight);
+            }
+
+            _fullResolutionTextureImage = CreateOrUpdateTextureImage(graphicsDevice, in _fullResolutionTextureImage, width, height);
+
+            // Frames of the previous size reference deleted textures
+            _frames.Clear();
+
+            foreach (var frame in _frames.Slots)
+            {
+                _bufferPool.Return(frame.ImageData);
+                frame.ImageData = _bufferPool.Rent<uint>(width * height);
+            }
+
+            _currentTextureImage = _previewTextureImages[0];
+        }
     }
 
-    public void RenderScene(CommandList commandList, Scene scene, Camera camera)
+    public void RenderScene(CommandList commandList, Scene scene, Camera camera, RenderOptions renderOptions)
     {
         ArgumentNullException.ThrowIfNull(scene);
 
-        // TODO: Handle scene changes
-        if (camera != _camera || scene.HasChanged)
+        var sceneSnapshot = UpdateSceneSnapshot(scene);
+
+        if (camera != _camera || renderOptions != _renderOptions || _isRenderInvalidated)
+        {
+            PostRenderRequest(sceneSnapshot, camera, renderOptions);
+            _isRenderInvalidated = false;
+        }
+
+        if (_frames.TryRead(out var frame))
         {
-            Console.WriteLine("Render LowRes");
-            _renderStopwatch.Restart();
-            _textureImage.FrameCount = 1;
-            _renderer.Render(_textureImage, scene, camera);
-            _renderStopwatch.Stop();
             _graphicsService.ResetCommandList(commandList);
-            _renderer.CommitImage(_textureImage, commandList);
+            _renderer.CommitImage(frame.Image, commandList);
             _graphicsService.SubmitCommandList(commandList);
 
-            RenderDuration = _renderStopwatch.ElapsedMilliseconds;
+            _currentTextureImage = frame.Image;
+            RenderDuration = (long)frame.RenderDuration.TotalMilliseconds;
 
-            // TODO: Cancel task when possible
-            _computeNewHighRes = true; 
-            _resetRenderFrameCount = 0;
-            _renderFrameCount = 0;
-            _fullResolutionTextureImage.FrameCount = 0;
+            if (frame.IsFullResolution)
+            {
+                LastRenderTime = DateTime.Now;
+            }
         }
-        
-        if (_fullResolutionRenderingTask == null && _isFullResolutionRenderComplete == true && _computeNewHighRes == true && _resetRenderFrameCount > 5)
+
+        _camera = camera;
+        _renderOptions = renderOptions;
+    }
+
+    public void RenderToImage(RenderSettings renderSettings, Scene scene, Camera camera)
+    {
+        if (_fileRenderingTask == null || _fileRenderingTask.IsCompleted)
         {
-            _computeNewHighRes = false;
-            _isFullResolutionRenderComplete = false;
+            var sceneSnapshot = UpdateSceneSnapshot(scene);
 
-            // TODO: Use a cancelation token here
-            _fullResolutionTextureImage.FrameCount++;
-            _fullResolutionRenderingTask = new Task(() =>
+            _fileRenderingTask = new Task(() =>
             {
-                Console.WriteLine($"Render HighRes {_fullResolutionTextureImage.FrameCount}");
-                _renderStopwatch.Restart();
-                _renderer.Render(_fullResolutionTextureImage, scene, camera);
-                _renderStopwatch.Stop();
-                RenderDuration = _renderStopwatch.ElapsedMilliseconds;
+                FileRenderingProgression = 0;
+                RenderBandsToFile(renderSettings, sceneSnapshot, camera);
+                FileRenderingProgression = 100;
             });
 
-            _fullResolutionRenderingTask.Start();
+            _fileRenderingTask.Start();
         }
+    }
 
-        if (_fullResolutionRenderingTask != null && _fullResolutionRenderingTask.Status == TaskStatus.RanToCompletion)
+    public void Dispose()
+    {
+        _isStopping = true;
+        _renderRequest?.CancellationTokenSource.Cancel();
+        _renderRequestEvent.Set();
+        _renderThread?.Join();
+        _renderRequestEvent.Dispose();
+
+        // NOTE: The textures are destroyed with the graphics device
+        foreach (var previewTextureImage in _previewTextureImages)
         {
-            _isFullResolutionRenderComplete = true;
-            _fullResolutionRenderingTask = null;
-            LastRenderTime = DateTime.Now;
+            previewTextureImage.AccumulationBuffer.Dispose();
+        }
 
-            if (_resetRenderFrameCount > 5)
-            {
-                _renderFrameCount++;
-            }
+        _fullResolutionTextureImage.AccumulationBuffer.Dispose();
+        _denoisedAccumulationBuffer.Dispose();
 
-            // If accumulate 
-            if (_fullResolutionTextureImage.FrameCount < 50)
-            {
-                _computeNewHighRes = true;
-            }
+        foreach (var frame in _frames.Slots)
+        {
+            _bufferPool.Return(frame.ImageData);
+        }
 
-            _graphicsService.ResetCommandList(commandList);
-            _renderer.CommitImage(_fullResolutionTextureImage, commandList);
-            _graphicsService.SubmitCommandList(commandList);
+        _renderMetrics.Dispose();
+        GC.SuppressFinalize(this);
+    }
+
+    public void CheckRenderToImageErrors()
+    {
+        if (_fileRenderingTask != null && _fileRenderingTask.Exception != null)
+        {
+            Console.WriteLine(_fileRenderingTask.Exception);
+            _fileRenderingTask = null;
         }
+    }
 
-        _camera = camera;
-        _resetRenderFrameCount++;
+    // NOTE: Renders never read the scene edited by the UI thread, they read a snapshot taken
+    // after the changes are committed. A new snapshot is only taken when the scene changed.
+    private Scene UpdateSceneSnapshot(Scene scene)
+    {
+        var sceneChanges = scene.CommitChanges();
+
+        if (_sceneSnapshot is null || sceneChanges.HasChanges)
+        {
+            _sceneSnapshot = scene.CreateSnapshot();
+            _isRenderInvalidated = true;
+        }
+
+        return _sceneSnapshot;
     }
 
-    public void RenderToImage(RenderSettings renderSettings, Scene scene, Camera camera)
+    // NOTE: The previous request is canceled before the new one is visible so the render
+    // thread, which disposes the requests it is done with, never disposes a request that is
+    // still going to be canceled
+    private void PostRenderRequest(Scene scene, Camera camera, RenderOptions renderOptions)
     {
-        const int iterationCount = 50;
+        _renderRequest?.CancellationTokenSource.Cancel();
 
-        if (_fileRenderingTask == null || _fileRenderingTask.IsCompleted)
+        Volatile.Write(ref _renderRequest, new RenderRequest
         {
-            _fileRenderingTask = new Task(() =>
-            {
-                var width = renderSettings.Resolution.Width;
-                var height = renderSettings.Resolution.Height;
-                var outputPath = renderSettings.OutputPath;
+            Scene = scene,
+            Camera = camera,
+            RenderOptions = renderOptions,
+            CancellationTokenSource = new CancellationTokenSource()
+        });
 
-                var outputImage = new FileImage
-                {
-                    Width = width,
-                    Height = height,
-                    ImageData = new Vector4[width * height],
-                    AccumulationData = new Vector4[width * height]
-                };
+        if (_renderThread == null)
+        {
+            _renderThread = new Thread(RunRenderThread) { Name = "Render", IsBackground = true };
+            _renderThread.Start();
+        }
 
-                var fileCamera = camera with
-                {
-                    AspectRatio = (float)width / height
-                };
+        _renderRequestEvent.Set();
+    }
 
-                FileRenderingProgression = 0;
+    private void RunRenderThread()
+    {
+        RenderRequest? renderRequest = null;
+        var previewLevel = -1;
+        var isPreviewComplete = false;
+        var isComplete = false;
+        var fullResolutionFrameCount = 0;
+
+        while (!_isStopping)
+        {
+            var latestRenderRequest = Volatile.Read(ref _renderRequest);
+
+            if (latestRenderRequest != renderRequest)
+            {
+                renderRequest?.CancellationTokenSource.Dispose();
+                renderRequest = latestRenderRequest;
+
+                previewLevel = -1;
+                isPreviewComplete = false;
+                isComplete = false;
+                fullResolutionFrameCount = 0;
+            }
+
+            if (renderRequest == null || isComplete)
+            {
+                _renderRequestEvent.WaitOne();
+                continue;
+            }
 
-                for (var i = 0; i < iterationCount; i++)
+            try
+            {
+                lock (_renderLock)
                 {
-                    outputImage.FrameCount++;
-                    _fileRenderer.Render(outputImage, scene, fileCamera);
-                    FileRenderingProgression = (int)((float)i / iterationCount * 100);
+                    var cancellationToken = renderRequest.CancellationTokenSource.Token;
+                    cancellationToken.ThrowIfCancellationRequested();
+
+                    if (previewLevel < 0)
+                    {
+                        // NOTE: The camera changes every frame while it moves, so motion previews are
+                        // never canceled, otherwise no preview would be published until it stops. The
+                        // newest request is picked up once the preview is published.
+                        var (motionPreviewLevel, sampleCount) = _previewResolutionController.GetMotionFrame();
+
+                        RenderPreview(renderRequest, motionPreviewLevel, sampleCount, CancellationToken.None);
+                        previewLevel = motionPreviewLevel;
+                    }
+                    else if (!isPreviewComplete)
+                    {
+                        // NOTE: The preview steps up one level at a time once the camera is idle, the
+                        // full resolution pass only starts after the last level that fits in a frame
+                        var nextPreviewLevel = _previewResolutionController.GetIdleLevel(previewLevel);
+
+                        if (nextPreviewLevel >= _previewResolutionController.LevelCount)
+                        {
+                            isPreviewComplete = true;
+                            _fullResolutionTextureImage.AccumulationBuffer.Reset();
+                        }
+                        else
+                        {
+                            RenderPreview(renderRequest, nextPreviewLevel, 1, cancellationToken);
+                            previewLevel = nextPreviewLevel;
+                        }
+                    }
+                    else
+                    {
+                        // Accumulate until the sample limit is reached or every block converged
+                        RenderFullResolution(renderRequest, cancellationToken);
+                        fullResolutionFrameCount++;
+
+                        isComplete = fullResolutionFrameCount >= MaxFullResolutionFrameCount || _fullResolutionTextureImage.AccumulationBuffer.IsConverged;
+                    }
                 }
+            }
+            catch (OperationCanceledException)
+            {
+                // A newer request or a resize canceled the request
+                isComplete = true;
+            }
+            catch (Exception exception)
+            {
+                Console.WriteLine(exception);
+                isComplete = true;
+            }
+        }
+    }
 
-                FileRenderingProgression = 100;
+    private void RenderPreview(RenderRequest renderRequest, int previewLevel, int sampleCount, CancellationToken cancellationToken)
+    {
+        var previewTextureImage = _previewTextureImages[previewLevel];
 
-                _fileRenderer.CommitImage(outputImage, outputPath);
-            });
+        Console.WriteLine($"Render Preview {previewTextureImage.Width}x{previewTextureImage.Height} ({sampleCount} samples)");
+        var stopwatch = Stopwatch.StartNew();
+        previewTextureImage.AccumulationBuffer.Reset();
 
-            _fileRenderingTask.Start();
+        for (var i = 0; i < sampleCount; i++)
+        {
+            _renderer.Render(previewTextureImage, renderRequest.Scene, renderRequest.Camera, renderRequest.RenderOptions, cancellationToken);
         }
+
+        // The denoiser runs in the frame so its time is part of the measurement
+        var outputImage = DenoiseImage(previewTextureImage, renderRequest.RenderOptions, cancellationToken);
+
+        stopwatch.Stop();
+        _previewResolutionController.AddMeasurement((long)previewTextureImage.Width * previewTextureImage.Height * sampleCount, stopwatch.Elapsed);
+
+        PublishFrame(outputImage, renderRequest.RenderOptions, stopwatch.Elapsed, false);
     }
 
-    public void CheckRenderToImageErrors()
+    private void RenderFullResolution(RenderRequest renderRequest, CancellationToken cancellationToken)
     {
-        if (_fileRenderingTask != null && _fileRenderingTask.Exception != null)
+        Console.WriteLine($"Render HighRes {_fullResolutionTextureImage.AccumulationBuffer.FrameCount + 1}");
+        var previousSampleCount = _renderer.Counters.SampleCount;
+        var stopwatch = Stopwatch.StartNew();
+        _renderer.Render(_fullResolutionTextureImage, renderRequest.Scene, renderRequest.Camera, renderRequest.RenderOptions, cancellationToken);
+        var outputImage = DenoiseImage(_fullResolutionTextureImage, renderRequest.RenderOptions, cancellationToken);
+        stopwatch.Stop();
+
+        // Converged pixels are not rendered again so the samples are counted instead of the pixels
+        _previewResolutionController.AddMeasurement(_renderer.Counters.SampleCount - previousSampleCount, stopwatch.Elapsed);
+
+        PublishFrame(outputImage, renderRequest.RenderOptions, stopwatch.Elapsed, true);
+    }
+
+    // NOTE: The accumulation buffer keeps the samples, the denoised image goes in a buffer
+    // shared by every frame since a frame is resolved before the next one is denoised
+    private TextureImage DenoiseImage(in TextureImage textureImage, RenderOptions renderOptions, CancellationToken cancellationToken)
+    {
+        if (!renderOptions.IsDenoiserEnabled)
         {
-            Console.WriteLine(_fileRenderingTask.Exception);
-            _fileRenderingTask = null;
+            return textureImage;
+        }
+
+        if (_denoisedAccumulationBuffer.Width != textureImage.Width || _denoisedAccumulationBuffer.Height != textureImage.Height)
+        {
+            _denoisedAccumulationBuffer.Dispose();
+            _denoisedAccumulationBuffer = new AccumulationBuffer(textureImage.Width, textureImage.Height, _bufferPool);
         }
+
+        _denoiser.Denoise(textureImage.AccumulationBuffer, _denoisedAccumulationBuffer, renderOptions.ThreadCount, cancellationToken);
+        return textureImage with { AccumulationBuffer = _denoisedAccumulationBuffer };
+    }
+
+    private void PublishFrame(in TextureImage textureImage, RenderOptions renderOptions, TimeSpan renderDuration, bool isFullResolution)
+    {
+        var frame = _frames.WriteSlot;
+
+        frame.Image = textureImage with
+        {
+            ImageData = frame.ImageData.AsMemory(0, textureImage.Width * textureImage.Height),
+            ToneMappingOperator = renderOptions.ToneMappingOperator
+        };
+
+        frame.RenderDuration = renderDuration;
+        frame.IsFullResolution = isFullResolution;
+
+        TextureImageWriter.ResolveImage(frame.Image);
+        _frames.Publish();
     }
 
     private TextureImage CreateOrUpdateTextureImage(GraphicsDevice graphicsDevice, in TextureImage textureImage, int width, int height)
     {
-        // TODO: Call a delete function
+        ReleaseTextureImage(textureImage);
+
         var cpuTexture = _graphicsService.CreateTexture(graphicsDevice, width, height, 1, 1, 1, TextureFormat.Rgba8UnormSrgb, TextureUsage.Staging, TextureType.Texture2D);
         var gpuTexture = _graphicsService.CreateTexture(graphicsDevice, width, height, 1, 1, 1, TextureFormat.Rgba8UnormSrgb, TextureUsage.Sampled, TextureType.Texture2D);
 
-        var imageData = new uint[width * height];
-        var accumulationData = new Vector4[width * height];
-
+        // NOTE: The image data is in the frames of the triple buffer
         return textureImage with
         {
             Width = width,
             Height = height,
             CpuTexture = cpuTexture,
             GpuTexture = gpuTexture,
-            ImageData = imageData,
-            AccumulationData = accumulationData
+            AccumulationBuffer = new AccumulationBuffer(width, height, _bufferPool, true)
+        };
+    }
+
+    // NOTE: The textures are destroyed once the GPU is done with them, the arrays go back to
+    // the pool for the next size
+    private void ReleaseTextureImage(in TextureImage textureImage)
+    {
+        if (textureImage.Width == 0 || textureImage.Height == 0)
+        {
+            return;
+        }
+
+        _graphicsService.DeleteTexture(textureImage.CpuTexture);
+        _graphicsService.DeleteTexture(textureImage.GpuTexture);
+
+        textureImage.AccumulationBuffer.Dispose();
+    }
+
+    // NOTE: Bands of rows are rendered to completion from the top of the image and streamed to
+    // the output file, so the memory usage only depends on the band height
+    private void RenderBandsToFile(RenderSettings renderSettings, Scene scene, Camera camera)
+    {
+        var width = renderSettings.Resolution.Width;
+        var height = renderSettings.Resolution.Height;
+        var isDenoiserEnabled = renderSettings.RenderOptions.IsDenoiserEnabled;
+
+        // NOTE: The denoiser needs the neighbours of every pixel so the image is a single band,
+        // a denoised image with 16 samples has less error than 50 samples without denoising
+        var bandHeight = isDenoiserEnabled ? height : 64;
+        var iterationCount = isDenoiserEnabled ? 16 : 50;
+
+        var outputImage = new FileImage
+        {
+            Width = width,
+            Height = height,
+            AccumulationBuffer = new AccumulationBuffer(width, Math.Min(bandHeight, height), _bufferPool, isDenoiserEnabled),
+            ToneMappingOperator = renderSettings.RenderOptions.ToneMappingOperator
+        };
+
+        var fileCamera = camera with
+        {
+            AspectRatio = (float)width / height
         };
+
+        using var accumulationBuffer = outputImage.AccumulationBuffer;
+        using var fileStream = new FileStream(renderSettings.OutputPath, FileMode.Create);
+        using var pngWriter = new PngStreamWriter(fileStream, width, height);
+
+        for (var bandEnd = height; bandEnd > 0; bandEnd -= bandHeight)
+        {
+            var region = new Tile { X = 0, Y = Math.Max(bandEnd - bandHeight, 0), Width = width, Height = Math.Min(bandHeight, bandEnd) };
+            var bandImage = region.Height == outputImage.AccumulationBuffer.Height ? outputImage : outputImage with { AccumulationBuffer = new AccumulationBuffer(width, region.Height, _bufferPool) };
+            var renderOptions = renderSettings.RenderOptions with { Region = region };
+
+            bandImage.AccumulationBuffer.Reset();
+
+            for (var i = 0; i < iterationCount && !bandImage.AccumulationBuffer.IsConverged; i++)
+            {
+                _fileRenderer.Render(bandImage, scene, fileCamera, renderOptions, CancellationToken.None);
+            }
+
+            if (isDenoiserEnabled)
+            {
+                using var denoisedAccumulationBuffer = new AccumulationBuffer(width, region.Height, _bufferPool);
+
+                _denoiser.Denoise(bandImage.AccumulationBuffer, denoisedAccumulationBuffer, renderOptions.ThreadCount, CancellationToken.None);
+                pngWriter.WriteRows(denoisedAccumulationBuffer, bandImage.ToneMappingOperator);
+            }
+            else
+            {
+                pngWriter.WriteRows(bandImage.AccumulationBuffer, bandImage.ToneMappingOperator);
+            }
+
+            if (bandImage.AccumulationBuffer != outputImage.AccumulationBuffer)
+            {
+                bandImage.AccumulationBuffer.Dispose();
+            }
+
+            FileRenderingProgression = Math.Min((int)((float)(height - region.Y) / height * 100), 99);
+        }
+    }
+
+    private sealed record RenderRequest
+    {
+        public required Scene Scene { get; init; }
+        public required Camera Camera { get; init; }
+        public required RenderOptions RenderOptions { get; init; }
+        public required CancellationTokenSource CancellationTokenSource { get; init; }
+    }
+
+    private sealed class RenderFrame
+    {
+        public uint[] ImageData { get; set; } = [];
+        public TextureImage Image { get; set; }
+        public TimeSpan RenderDuration { get; set; }
+        public bool IsFullResolution { get; set; }
     }
 }
\ No newline at end of file
@@ -4,4 +4,5 @@ public record struct RenderSettings
 {
     public required RenderResolutionItem Resolution { get; set; }
     public required string OutputPath { get; set; }
+    public required RenderOptions RenderOptions { get; set; }
 }
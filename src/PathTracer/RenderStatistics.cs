@@ -19,4 +19,14 @@ public record struct RenderStatistics
     public int GCGen0Count { get; set; }
     public int GCGen1Count { get; set; }
     public int GCGen2Count { get; set; }
+    public long RaysPerSecond { get; set; }
+    public long ShadowRaysPerSecond { get; set; }
+    public long SamplesPerSecond { get; set; }
+    public float BouncesPerPath { get; set; }
+    public float RussianRouletteRatio { get; set; }
+    public float HitRatio { get; set; }
+    public float IntersectionTestsPerRay { get; set; }
+    public float RenderStageTime { get; set; }
+    public float AccumulateStageTime { get; set; }
+    public float ConvergenceStageTime { get; set; }
 }
@@ -0,0 +1,59 @@
+namespace PathTracer;
+
+// NOTE: Single producer, single consumer triple buffer. The producer always has a slot to
+// write into and the consumer always reads the latest published slot, neither of them waits
+// for the other. Publishing swaps the write slot with the ready slot and reading swaps the
+// read slot with the ready slot when it is new, the swaps are a single atomic exchange of
+// the ready slot index and its new flag so frames are skipped but never torn.
+public sealed class TripleBuffer<T> where T : class
+{
+    private const int IndexMask = 0b11;
+    private const int NewFlag = 0b100;
+
+    private readonly T[] _slots;
+    private int _writeIndex;
+    private int _readIndex;
+    private int _readyState;
+
+    public TripleBuffer(T firstSlot, T secondSlot, T thirdSlot)
+    {
+        ArgumentNullException.ThrowIfNull(firstSlot);
+        ArgumentNullException.ThrowIfNull(secondSlot);
+        ArgumentNullException.ThrowIfNull(thirdSlot);
+
+        _slots = [firstSlot, secondSlot, thirdSlot];
+        _writeIndex = 0;
+        _readIndex = 1;
+        _readyState = 2;
+    }
+
+    public ReadOnlySpan<T> Slots => _slots;
+
+    // NOTE: Only the producer can use the write slot
+    public T WriteSlot => _slots[_writeIndex];
+
+    public void Publish()
+    {
+        _writeIndex = Interlocked.Exchange(ref _readyState, _writeIndex | NewFlag) & IndexMask;
+    }
+
+    public bool TryRead(out T slot)
+    {
+        if ((Volatile.Read(ref _readyState) & NewFlag) == 0)
+        {
+            slot = _slots[_readIndex];
+            return false;
+        }
+
+        _readIndex = Interlocked.Exchange(ref _readyState, _readIndex) & IndexMask;
+        slot = _slots[_readIndex];
+
+        return true;
+    }
+
+    // NOTE: Drops the published slot, neither side can use the buffer during the call
+    public void Clear()
+    {
+        _readyState &= IndexMask;
+    }
+}
\ No newline at end of file
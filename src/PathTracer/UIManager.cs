@@ -7,6 +7,7 @@ public class UIManager : IUIManager
     private readonly ReadOnlyMemory<RenderResolutionItem> _resolutionItems;
 
     private RenderSettings _renderSettings;
+    private RenderOptions _renderOptions;
 
     public UIManager(IUIService uiService, ICommandManager commandManager)
     {
@@ -22,10 +23,15 @@ public class UIManager : IUIManager
         _renderSettings = new RenderSettings
         {
             Resolution = _resolutionItems.Span[0],
-            OutputPath = "TestData/Output.png"
+            OutputPath = "TestData/Output.png",
+            RenderOptions = new RenderOptions()
         };
+
+        _renderOptions = new RenderOptions();
     }
 
+    public RenderOptions RenderOptions => _renderOptions;
+
     public void Init(NativeWindow window, GraphicsDevice graphicsDevice)
     {
         _uiService.Init(window, graphicsDevice);
@@ -57,6 +63,7 @@ public class UIManager : IUIManager
         if (_uiService.BeginPanel("Inspector"))
         {
             BuildStatistics(renderStatistics);
+            BuildRenderOptions();
             BuildSceneProperties(scene);
             BuildRenderToImage(renderStatistics);
 
@@ -82,6 +89,125 @@ public class UIManager : IUIManager
             _uiService.Text($"Allocated manager memory: {Utils.ConvertBytesToMegaBytes(renderStatistics.AllocatedManagedMemory)} MB");
             _uiService.Text($"CPU Usage: {renderStatistics.CpuUsage} percent");
             _uiService.Text($"GC count: Gen0={renderStatistics.GCGen0Count}, Gen1={renderStatistics.GCGen1Count}, Gen2={renderStatistics.GCGen2Count}");
+            _uiService.Text($"Rays/s: {renderStatistics.RaysPerSecond:N0}, Shadow rays/s: {renderStatistics.ShadowRaysPerSecond:N0}, Samples/s: {renderStatistics.SamplesPerSecond:N0}");
+            _uiService.Text($"Path length: {renderStatistics.BouncesPerPath:N2}, Roulette: {renderStatistics.RussianRouletteRatio:P1}, Hit ratio: {renderStatistics.HitRatio:P1}");
+            _uiService.Text($"Intersection tests/ray: {renderStatistics.IntersectionTestsPerRay:N1}");
+            _uiService.Text($"Stage time: Render={renderStatistics.RenderStageTime:N0} ms, Accumulate={renderStatistics.AccumulateStageTime:N0} ms, Convergence={renderStatistics.ConvergenceStageTime:N0} ms");
+            _uiService.NewLine();
+        }
+    }
+
+    private void BuildRenderOptions()
+    {
+        if (_uiService.CollapsingHeader("Render Options"))
+        {
+            if (_uiService.BeginCombo("Mode", _renderOptions.RenderMode.ToString()))
+            {
+                foreach (var renderMode in Enum.GetValues<RenderMode>())
+                {
+                    if (_uiService.Selectable(renderMode.ToString(), renderMode == _renderOptions.RenderMode))
+                    {
+                        _renderOptions = _renderOptions with { RenderMode = renderMode };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            if (_uiService.BeginCombo("Tone Mapping", _renderOptions.ToneMappingOperator.ToString()))
+            {
+                foreach (var toneMappingOperator in Enum.GetValues<ToneMappingOperator>())
+                {
+                    if (_uiService.Selectable(toneMappingOperator.ToString(), toneMappingOperator == _renderOptions.ToneMappingOperator))
+                    {
+                        _renderOptions = _renderOptions with { ToneMappingOperator = toneMappingOperator };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            if (_uiService.BeginCombo("Tile Order", _renderOptions.TileOrder.ToString()))
+            {
+                foreach (var tileOrder in Enum.GetValues<TileOrder>())
+                {
+                    if (_uiService.Selectable(tileOrder.ToString(), tileOrder == _renderOptions.TileOrder))
+                    {
+                        _renderOptions = _renderOptions with { TileOrder = tileOrder };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            if (_uiService.BeginCombo("Tile Size", _renderOptions.TileSize.ToString()))
+            {
+                for (var tileSize = 8; tileSize <= 128; tileSize *= 2)
+                {
+                    if (_uiService.Selectable(tileSize.ToString(), tileSize == _renderOptions.TileSize))
+                    {
+                        _renderOptions = _renderOptions with { TileSize = tileSize };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            if (_uiService.BeginCombo("Max Bounces", _renderOptions.MaxBounceCount.ToString()))
+            {
+                for (var maxBounceCount = 2; maxBounceCount <= 32; maxBounceCount *= 2)
+                {
+                    if (_uiService.Selectable(maxBounceCount.ToString(), maxBounceCount == _renderOptions.MaxBounceCount))
+                    {
+                        _renderOptions = _renderOptions with { MaxBounceCount = maxBounceCount };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            var isRussianRouletteEnabled = _renderOptions.RussianRouletteBounceCount < _renderOptions.MaxBounceCount;
+
+            if (_uiService.BeginCombo("Russian Roulette", isRussianRouletteEnabled ? _renderOptions.RussianRouletteBounceCount.ToString() : "Off"))
+            {
+                if (_uiService.Selectable("Off", !isRussianRouletteEnabled))
+                {
+                    _renderOptions = _renderOptions with { RussianRouletteBounceCount = int.MaxValue };
+                }
+
+                for (var russianRouletteBounceCount = 1; russianRouletteBounceCount < _renderOptions.MaxBounceCount; russianRouletteBounceCount++)
+                {
+                    if (_uiService.Selectable(russianRouletteBounceCount.ToString(), isRussianRouletteEnabled && russianRouletteBounceCount == _renderOptions.RussianRouletteBounceCount))
+                    {
+                        _renderOptions = _renderOptions with { RussianRouletteBounceCount = russianRouletteBounceCount };
+                    }
+                }
+
+                _uiService.EndCombo();
+            }
+
+            if (_uiService.BeginCombo("Denoiser", _renderOptions.IsDenoiserEnabled ? "On" : "Off"))
+            {
+                if (_uiService.Selectable("Off", !_renderOptions.IsDenoiserEnabled))
+                {
+                    _renderOptions = _renderOptions with { IsDenoiserEnabled = false };
+                }
+
+                if (_uiService.Selectable("On", _renderOptions.IsDenoiserEnabled))
+                {
+                    _renderOptions = _renderOptions with { IsDenoiserEnabled = true };
+                }
+
+                _uiService.EndCombo();
+            }
+
+            var adaptiveErrorThreshold = _renderOptions.AdaptiveErrorThreshold;
+
+            if (_uiService.DragFloat("Adaptive Error", ref adaptiveErrorThreshold, 0.001f))
+            {
+                _renderOptions = _renderOptions with { AdaptiveErrorThreshold = MathF.Max(adaptiveErrorThreshold, 0.0f) };
+            }
+
             _uiService.NewLine();
         }
     }
@@ -103,23 +229,17 @@ public class UIManager : IUIManager
              
                 if (_uiService.DragFloat3("Position", ref position))
                 {
-                    sphere.Position = position;
-                    scene.Spheres[i] = sphere;
-                    scene.HasChanged = true;
+                    scene.UpdateSphere(i, scene.Spheres[i] with { Position = position });
                 }
 
                 if (_uiService.DragFloat("Radius", ref radius))
                 {
-                    sphere.Radius = radius;
-                    scene.Spheres[i] = sphere;
-                    scene.HasChanged = true;
+                    scene.UpdateSphere(i, scene.Spheres[i] with { Radius = radius });
                 }
 
                 if (_uiService.DragFloat("MaterialIndex", ref materialIndex))
                 {
-                    sphere.MaterialIndex = (int)materialIndex;
-                    scene.Spheres[i] = sphere;
-                    scene.HasChanged = true;
+                    scene.UpdateSphere(i, scene.Spheres[i] with { MaterialIndex = (int)materialIndex });
                 }
 
                 _uiService.Separator();
@@ -136,23 +256,55 @@ public class UIManager : IUIManager
                 var albedo = material.Albedo;
                 var roughness = material.Roughness;
                 var metallic = material.Metallic;
+                var emission = material.Emission;
 
                 if (_uiService.ColorEdit3("Albedo", ref albedo))
                 {
-                    scene.Materials[i] = material with { Albedo = albedo };
-                    scene.HasChanged = true;
+                    scene.UpdateMaterial(i, scene.Materials[i] with { Albedo = albedo });
                 }
                 
                 if (_uiService.DragFloat("Roughness", ref roughness))
                 {
-                    scene.Materials[i] = material with { Roughness = roughness };
-                    scene.HasChanged = true;
+                    scene.UpdateMaterial(i, scene.Materials[i] with { Roughness = roughness });
                 }
                 
                 if (_uiService.DragFloat("Metallic", ref metallic))
                 {
-                    scene.Materials[i] = material with { Metallic = metallic };
-                    scene.HasChanged = true;
+                    scene.UpdateMaterial(i, scene.Materials[i] with { Metallic = metallic });
+                }
+
+                if (_uiService.DragFloat3("Emission", ref emission))
+                {
+                    scene.UpdateMaterial(i, scene.Materials[i] with { Emission = emission });
+                }
+
+                _uiService.Separator();
+                _uiService.PopId();
+            }
+
+            for (var i = 0; i < scene.Lights.Count; i++)
+            {
+                _uiService.PushId($"Light{i}");
+
+                var light = scene.Lights[i];
+
+                var lightVector = light.Type == LightType.Directional ? light.Direction : light.Position;
+                var color = light.Color;
+                var intensity = light.Intensity;
+
+                if (_uiService.DragFloat3(light.Type == LightType.Directional ? "Direction" : "Position", ref lightVector))
+                {
+                    scene.UpdateLight(i, light.Type == LightType.Directional ? light with { Direction = lightVector } : light with { Position = lightVector });
+                }
+
+                if (_uiService.ColorEdit3("Light Color", ref color))
+                {
+                    scene.UpdateLight(i, scene.Lights[i] with { Color = color });
+                }
+
+                if (_uiService.DragFloat("Intensity", ref intensity))
+                {
+                    scene.UpdateLight(i, scene.Lights[i] with { Intensity = intensity });
                 }
 
                 _uiService.Separator();
@@ -191,6 +343,7 @@ public class UIManager : IUIManager
 
             if (_uiService.Button("Render", renderStatistics.FileRenderingProgression < 100 ? ControlStyles.Disabled : ControlStyles.None))
             {
+                _renderSettings.RenderOptions = _renderOptions;
                 _commandManager.SendCommand(new RenderCommand() { RenderSettings = _renderSettings });
             }
 
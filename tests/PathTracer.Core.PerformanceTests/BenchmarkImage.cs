@@ -0,0 +1,15 @@
+namespace PathTracer.Core.PerformanceTests;
+
+public readonly record struct BenchmarkImage : IImage
+{
+    public int Width { get; init; }
+    public int Height { get; init; }
+    public AccumulationBuffer AccumulationBuffer { get; init; }
+}
+
+public class BenchmarkImageWriter : IImageWriter<BenchmarkImage, object?>
+{
+    public void CommitImage(BenchmarkImage image, object? parameter)
+    {
+    }
+}
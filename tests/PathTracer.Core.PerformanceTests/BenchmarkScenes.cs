@@ -0,0 +1,120 @@
+using System.Numerics;
+
+namespace PathTracer.Core.PerformanceTests;
+
+public static class BenchmarkScenes
+{
+    public static Scene CreateDefaultScene()
+    {
+        var scene = new Scene();
+
+        scene.Materials.Add(new Material()
+        {
+            Albedo = new Vector3(1.0f, 1.0f, 0.0f),
+            Roughness = 0.0f,
+            Metallic = 1.0f
+        });
+
+        scene.Materials.Add(new Material()
+        {
+            Albedo = new Vector3(0.0f, 0.2f, 1.0f),
+            Roughness = 0.1f
+        });
+
+        scene.Spheres.Add(new Sphere()
+        {
+            Position = new Vector3(0.0f, 0.0f, 0.0f),
+            Radius = 1.0f,
+            MaterialIndex = 0
+        });
+
+        scene.Spheres.Add(new Sphere()
+        {
+            Position = new Vector3(0.0f, -101.0f, 0.0f),
+            Radius = 100.0f,
+            MaterialIndex = 1
+        });
+
+        scene.Lights.Add(new Light()
+        {
+            Direction = new Vector3(1.0f, -1.0f, 1.0f),
+            Intensity = 3.0f
+        });
+
+        return scene;
+    }
+
+    public static Scene CreateRandomSpheres(int sphereCount, int seed = 42)
+    {
+        var random = new Random(seed);
+        var scene = new Scene();
+
+        // Keep the sphere density constant so the cost only depends on the primitive count
+        var sceneSize = MathF.Max(2.0f, MathF.Cbrt(sphereCount) * 2.0f);
+
+        scene.Materials.Add(new Material());
+
+        for (var i = 0; i < sphereCount; i++)
+        {
+            scene.Spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, random.NextSingle() - 0.5f) * sceneSize,
+                Radius = random.NextSingle() * 0.4f + 0.1f
+            });
+        }
+
+        return scene;
+    }
+
+    // NOTE: Every instance references the same block of spheres with its own rotation and scale
+    public static Scene CreateRandomInstances(int instanceCount, int blockSphereCount = 64, int seed = 42)
+    {
+        var random = new Random(seed);
+        var scene = new Scene();
+        var block = new GeometryBlock();
+
+        var sceneSize = MathF.Max(2.0f, MathF.Cbrt(instanceCount) * 4.0f);
+
+        scene.Materials.Add(new Material());
+
+        for (var i = 0; i < blockSphereCount; i++)
+        {
+            block.Spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, random.NextSingle() - 0.5f) * 2.0f,
+                Radius = random.NextSingle() * 0.1f + 0.05f
+            });
+        }
+
+        scene.Geometries.Add(block);
+
+        for (var i = 0; i < instanceCount; i++)
+        {
+            scene.Instances.Add(new Instance
+            {
+                Position = new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, random.NextSingle() - 0.5f) * sceneSize,
+                Rotation = Quaternion.CreateFromYawPitchRoll(random.NextSingle() * MathF.Tau, random.NextSingle() * MathF.Tau, 0.0f),
+                Scale = random.NextSingle() * 0.5f + 0.75f
+            });
+        }
+
+        return scene;
+    }
+
+    public static Ray[] CreateRandomRays(int rayCount, int seed = 42)
+    {
+        var random = new Random(seed);
+        var rays = new Ray[rayCount];
+
+        for (var i = 0; i < rayCount; i++)
+        {
+            rays[i] = new Ray
+            {
+                Origin = new Vector3(0.0f, 0.0f, -100.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 2.0f))
+            };
+        }
+
+        return rays;
+    }
+}
@@ -0,0 +1,84 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[Config(typeof(RaysPerSecondConfig))]
+public class BoundingVolumeHierarchyBenchmark
+{
+    private const int RayCount = 4096;
+
+    private Scene _scene = new();
+    private Ray[] _rays = Array.Empty<Ray>();
+    private BoundingVolumeHierarchy? _boundingVolumeHierarchy;
+
+    [Params(16, 1024, 16384, 65536)]
+    public int PrimitiveCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _scene = BenchmarkScenes.CreateRandomSpheres(PrimitiveCount);
+        _rays = BenchmarkScenes.CreateRandomRays(RayCount);
+        _boundingVolumeHierarchy = BoundingVolumeHierarchy.Build(_scene.Spheres);
+    }
+
+    [Benchmark(Baseline = true, OperationsPerInvoke = RayCount)]
+    public int LinearScan()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            var minimumHitDistance = float.MaxValue;
+            var objectIndex = -1;
+
+            for (var i = 0; i < _scene.Spheres.Count; i++)
+            {
+                var sphere = _scene.Spheres[i];
+                var origin = ray.Origin - sphere.Position;
+
+                var a = Vector3.Dot(ray.Direction, ray.Direction);
+                var b = 2.0f * Vector3.Dot(origin, ray.Direction);
+                var c = Vector3.Dot(origin, origin) - sphere.Radius * sphere.Radius;
+                var discriminant = b * b - 4.0f * a * c;
+
+                if (discriminant < 0.0f)
+                {
+                    continue;
+                }
+
+                var t = (-b + -MathF.Sqrt(discriminant)) / (2.0f * a);
+
+                if (t > 0 && t < minimumHitDistance)
+                {
+                    objectIndex = i;
+                    minimumHitDistance = t;
+                }
+            }
+
+            hitCount += objectIndex != -1 ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark(OperationsPerInvoke = RayCount)]
+    public int BoundingVolumeHierarchyTraversal()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            hitCount += _boundingVolumeHierarchy!.Intersect(ray, out _, out _) ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark]
+    public BoundingVolumeHierarchy BuildHierarchy()
+    {
+        return BoundingVolumeHierarchy.Build(_scene.Spheres);
+    }
+}
@@ -0,0 +1,45 @@
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[Config(typeof(RaysPerSecondConfig))]
+public class InstanceAccelerationStructureBenchmark
+{
+    private const int RayCount = 4096;
+
+    private Scene _scene = new();
+    private Ray[] _rays = Array.Empty<Ray>();
+    private InstanceAccelerationStructure? _instanceAccelerationStructure;
+
+    [Params(1024, 65536, 1048576)]
+    public int InstanceCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _scene = BenchmarkScenes.CreateRandomInstances(InstanceCount);
+        _rays = BenchmarkScenes.CreateRandomRays(RayCount);
+
+        _scene.CommitChanges();
+        _instanceAccelerationStructure = _scene.InstanceAccelerationStructure;
+    }
+
+    [Benchmark(OperationsPerInvoke = RayCount)]
+    public int InstanceTraversal()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            hitCount += _instanceAccelerationStructure!.Intersect(ray, out _, out _, out _) ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark]
+    public InstanceAccelerationStructure BuildTopLevel()
+    {
+        return InstanceAccelerationStructure.Build(_scene.Geometries, _scene.Instances);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[Config(typeof(RaysPerSecondConfig))]
+public class PackedSpheresBenchmark
+{
+    private const int RayCount = 4096;
+
+    private Scene _scene = new();
+    private Ray[] _rays = Array.Empty<Ray>();
+    private PackedSpheres? _packedSpheres;
+
+    // NOTE: 2 is the default two spheres scene
+    [Params(2, 1000)]
+    public int SphereCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _scene = SphereCount == 2 ? BenchmarkScenes.CreateDefaultScene() : BenchmarkScenes.CreateRandomSpheres(SphereCount);
+        _rays = BenchmarkScenes.CreateRandomRays(RayCount);
+        _packedSpheres = PackedSpheres.Create(_scene);
+    }
+
+    [Benchmark(Baseline = true, OperationsPerInvoke = RayCount)]
+    public int SceneList()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            var minimumHitDistance = float.MaxValue;
+            var objectIndex = -1;
+
+            for (var i = 0; i < _scene.Spheres.Count; i++)
+            {
+                var sphere = _scene.Spheres[i];
+                var origin = ray.Origin - sphere.Position;
+
+                var a = Vector3.Dot(ray.Direction, ray.Direction);
+                var b = 2.0f * Vector3.Dot(origin, ray.Direction);
+                var c = Vector3.Dot(origin, origin) - sphere.Radius * sphere.Radius;
+                var discriminant = b * b - 4.0f * a * c;
+
+                if (discriminant < 0.0f)
+                {
+                    continue;
+                }
+
+                var t = (-b + -MathF.Sqrt(discriminant)) / (2.0f * a);
+
+                if (t > 0 && t < minimumHitDistance)
+                {
+                    objectIndex = i;
+                    minimumHitDistance = t;
+                }
+            }
+
+            hitCount += objectIndex != -1 ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark(OperationsPerInvoke = RayCount)]
+    public int PackedScalar()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            var hitDistance = float.MaxValue;
+            var objectIndex = -1;
+
+            _packedSpheres!.IntersectScalar(ray, 0, _packedSpheres.Count, ref hitDistance, ref objectIndex);
+            hitCount += objectIndex != -1 ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark(OperationsPerInvoke = RayCount)]
+    public int PackedSimd()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            hitCount += _packedSpheres!.Intersect(ray, out _, out _) ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+}
@@ -0,0 +1,44 @@
+using System.IO.Compression;
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[MemoryDiagnoser]
+public class PngStreamWriterBenchmark
+{
+    private const int Width = 1920;
+    private const int Height = 1080;
+
+    private AccumulationBuffer? _accumulationBuffer;
+
+    [Params(CompressionLevel.Fastest, CompressionLevel.Optimal)]
+    public CompressionLevel CompressionLevel { get; set; }
+
+    // NOTE: Smooth gradients compress like a rendered image, random noise would not compress at all
+    [GlobalSetup]
+    public void Setup()
+    {
+        var samples = new Vector4[Width];
+
+        _accumulationBuffer = new AccumulationBuffer(Width, Height);
+        var frameIndex = _accumulationBuffer.BeginFrame();
+
+        for (var i = 0; i < Height; i++)
+        {
+            for (var j = 0; j < Width; j++)
+            {
+                samples[j] = new Vector4((float)j / Width, (float)i / Height, 0.5f, 1.0f);
+            }
+
+            _accumulationBuffer.AccumulateTile(new Tile { X = 0, Y = i, Width = Width, Height = 1 }, frameIndex, samples);
+        }
+    }
+
+    [Benchmark]
+    public void WriteImage()
+    {
+        using var pngWriter = new PngStreamWriter(Stream.Null, Width, Height, CompressionLevel);
+        pngWriter.WriteRows(_accumulationBuffer!, ToneMappingOperator.Aces);
+    }
+}
\ No newline at end of file
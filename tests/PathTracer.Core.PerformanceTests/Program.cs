@@ -6,5 +6,15 @@ using BenchmarkDotNet.Running;
 var config = DefaultConfig.Instance.AddExporter(JsonExporter.Full)
                                    .AddDiagnoser(MemoryDiagnoser.Default);
 
-BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly)
-                 .RunAllJoined(config);
\ No newline at end of file
+// NOTE: Without arguments every benchmark runs in one summary, arguments are passed to
+// BenchmarkDotNet to filter the benchmarks or change the artifacts path
+if (args.Length == 0)
+{
+    BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly)
+                     .RunAllJoined(config);
+}
+else
+{
+    BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly)
+                     .Run(args, config);
+}
\ No newline at end of file
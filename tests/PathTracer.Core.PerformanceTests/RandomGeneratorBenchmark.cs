@@ -0,0 +1,62 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[MemoryDiagnoser]
+public class RandomGeneratorBenchmark
+{
+    private const int PixelCount = 4096;
+    private const int BounceCount = 5;
+
+    private readonly ThreadLocal<Random> _threadLocalRandom = new(() => new Random(Environment.TickCount * Environment.CurrentManagedThreadId));
+    private readonly RandomGenerator _randomGenerator = new();
+    private readonly LowDiscrepancyRandomGenerator _lowDiscrepancyRandomGenerator = new();
+
+    // NOTE: Previous implementation that looked up the thread local generator for every vector
+    [Benchmark(Baseline = true, OperationsPerInvoke = PixelCount * BounceCount)]
+    public Vector3 ThreadLocalRandom()
+    {
+        var result = Vector3.Zero;
+
+        for (var i = 0; i < PixelCount; i++)
+        {
+            for (var j = 0; j < BounceCount; j++)
+            {
+                var random = _threadLocalRandom.Value!;
+                result += new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, random.NextSingle() - 0.5f);
+            }
+        }
+
+        return result;
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount * BounceCount)]
+    public Vector3 Pcg32()
+    {
+        return SamplePixels(_randomGenerator);
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount * BounceCount)]
+    public Vector3 LowDiscrepancy()
+    {
+        return SamplePixels(_lowDiscrepancyRandomGenerator);
+    }
+
+    private static Vector3 SamplePixels(IRandomGenerator randomGenerator)
+    {
+        var result = Vector3.Zero;
+
+        for (var i = 0; i < PixelCount; i++)
+        {
+            var randomState = randomGenerator.CreateState(i, 1);
+
+            for (var j = 0; j < BounceCount; j++)
+            {
+                result += randomGenerator.GetVector3(ref randomState);
+            }
+        }
+
+        return result;
+    }
+}
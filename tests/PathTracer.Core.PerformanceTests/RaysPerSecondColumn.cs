@@ -0,0 +1,47 @@
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace PathTracer.Core.PerformanceTests;
+
+// NOTE: Benchmarks using this column must set OperationsPerInvoke to the number of rays traced
+public class RaysPerSecondColumn : IColumn
+{
+    public string Id => nameof(RaysPerSecondColumn);
+    public string ColumnName => "Rays/s";
+    public bool AlwaysShow => true;
+    public ColumnCategory Category => ColumnCategory.Custom;
+    public int PriorityInCategory => 0;
+    public bool IsNumeric => true;
+    public UnitType UnitType => UnitType.Dimensionless;
+    public string Legend => "Rays traced per second on one thread";
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+    {
+        return GetValue(summary, benchmarkCase, summary.Style);
+    }
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+    {
+        var statistics = summary[benchmarkCase]?.ResultStatistics;
+
+        if (statistics == null || benchmarkCase.Descriptor.OperationsPerInvoke <= 1)
+        {
+            return "-";
+        }
+
+        // Mean is expressed in nanoseconds per operation
+        var raysPerSecond = 1_000_000_000.0 / statistics.Mean;
+        return raysPerSecond.ToString("N0", style.CultureInfo);
+    }
+
+    public bool IsAvailable(Summary summary)
+    {
+        return true;
+    }
+
+    public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase)
+    {
+        return false;
+    }
+}
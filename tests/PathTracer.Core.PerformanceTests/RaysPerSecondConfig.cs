@@ -0,0 +1,11 @@
+using BenchmarkDotNet.Configs;
+
+namespace PathTracer.Core.PerformanceTests;
+
+public class RaysPerSecondConfig : ManualConfig
+{
+    public RaysPerSecondConfig()
+    {
+        AddColumn(new RaysPerSecondColumn());
+    }
+}
@@ -0,0 +1,160 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+// NOTE: Each stage of a frame on its own, with the primary rays of a 640x360 image. Results
+// are per pixel so the stages can be compared with each other. Frames alternate between two
+// sets of samples so the pixels have some variance.
+[MemoryDiagnoser]
+public class RenderStageBenchmark
+{
+    private const int ImageWidth = 640;
+    private const int ImageHeight = 360;
+    private const int PixelCount = ImageWidth * ImageHeight;
+    private const int TileSize = 64;
+
+    private Vector2[] _pixelCoordinates = Array.Empty<Vector2>();
+    private Ray[] _rays = Array.Empty<Ray>();
+    private Vector4[] _samples = Array.Empty<Vector4>();
+    private uint[] _resolvedRow = Array.Empty<uint>();
+    private RayGenerator? _rayGenerator;
+    private PrimaryRayCache? _primaryRayCache;
+    private BoundingVolumeHierarchy? _boundingVolumeHierarchy;
+    private AccumulationBuffer? _accumulationBuffer;
+    private AccumulationBuffer? _noisyAccumulationBuffer;
+    private AccumulationBuffer? _denoisedAccumulationBuffer;
+    private Denoiser? _denoiser;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var scene = BenchmarkScenes.CreateRandomSpheres(1024);
+        var random = new Random(42);
+
+        var camera = new Camera { Position = new Vector3(0.0f, 0.0f, -30.0f), AspectRatio = (float)ImageWidth / ImageHeight };
+
+        _rayGenerator = new RayGenerator(camera);
+        _primaryRayCache = new PrimaryRayCache(camera, ImageWidth, ImageHeight);
+        _boundingVolumeHierarchy = BoundingVolumeHierarchy.Build(scene.Spheres);
+        _accumulationBuffer = new AccumulationBuffer(ImageWidth, ImageHeight);
+        _noisyAccumulationBuffer = new AccumulationBuffer(ImageWidth, ImageHeight, null, true);
+        _denoisedAccumulationBuffer = new AccumulationBuffer(ImageWidth, ImageHeight);
+        _denoiser = new Denoiser();
+
+        _pixelCoordinates = new Vector2[PixelCount];
+        _rays = new Ray[PixelCount];
+        _samples = new Vector4[TileSize * TileSize * 2];
+        _resolvedRow = new uint[ImageWidth];
+
+        for (var i = 0; i < PixelCount; i++)
+        {
+            var (y, x) = Math.DivRem(i, ImageWidth);
+
+            _pixelCoordinates[i] = new Vector2((float)x / ImageWidth, (float)y / ImageHeight) * 2.0f - Vector2.One;
+            _rays[i] = _rayGenerator.GenerateRay(_pixelCoordinates[i]);
+        }
+
+        for (var i = 0; i < _samples.Length; i++)
+        {
+            _samples[i] = new Vector4(random.NextSingle(), random.NextSingle(), random.NextSingle(), 1.0f);
+        }
+
+        for (var i = 0; i < AccumulationBuffer.MinimumConvergenceSampleCount; i++)
+        {
+            AccumulateTiles();
+        }
+
+        var features = new PixelFeatures[PixelCount];
+        var noisySamples = new Vector4[PixelCount];
+
+        for (var i = 0; i < PixelCount; i++)
+        {
+            var isHit = _boundingVolumeHierarchy.Intersect(_rays[i], out var hitDistance, out _);
+
+            features[i] = isHit ? new PixelFeatures { Albedo = new Vector3(0.5f), Normal = Vector3.UnitY, Depth = hitDistance } : new PixelFeatures { Albedo = Vector3.One };
+            noisySamples[i] = _samples[i % _samples.Length];
+        }
+
+        _noisyAccumulationBuffer.AccumulateTile(new Tile { X = 0, Y = 0, Width = ImageWidth, Height = ImageHeight }, _noisyAccumulationBuffer.BeginFrame(), noisySamples, features);
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public Vector3 GenerateRays()
+    {
+        var result = Vector3.Zero;
+
+        foreach (var pixelCoordinates in _pixelCoordinates)
+        {
+            result += _rayGenerator!.GenerateRay(pixelCoordinates).Direction;
+        }
+
+        return result;
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public Vector3 GenerateCachedRays()
+    {
+        var result = Vector3.Zero;
+        var jitter = new Vector2(0.5f, 0.5f);
+
+        for (var i = 0; i < ImageHeight; i++)
+        {
+            var rowDirection = _primaryRayCache!.GetRowDirection(0, i);
+
+            for (var j = 0; j < ImageWidth; j++)
+            {
+                result += _primaryRayCache.GenerateRay(rowDirection, j, jitter).Direction;
+            }
+        }
+
+        return result;
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public int TraceRays()
+    {
+        var hitCount = 0;
+
+        foreach (var ray in _rays)
+        {
+            hitCount += _boundingVolumeHierarchy!.Intersect(ray, out _, out _) ? 1 : 0;
+        }
+
+        return hitCount;
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public void AccumulateTiles()
+    {
+        var frameIndex = _accumulationBuffer!.BeginFrame();
+
+        foreach (var tile in TileScheduler.CreateTiles(ImageWidth, ImageHeight, TileSize, TileOrder.Scanline))
+        {
+            _accumulationBuffer.AccumulateTile(tile, frameIndex, _samples.AsSpan(frameIndex % 2 * TileSize * TileSize, tile.PixelCount));
+        }
+    }
+
+    // NOTE: The threshold is low enough that no block converges so every run does the same work
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public int UpdateConvergence()
+    {
+        return _accumulationBuffer!.UpdateConvergence(0.0001f);
+    }
+
+    // NOTE: Single threaded so the time per pixel can be compared with the other stages
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public void Denoise()
+    {
+        _denoiser!.Denoise(_noisyAccumulationBuffer!, _denoisedAccumulationBuffer!, 1, CancellationToken.None);
+    }
+
+    [Benchmark(OperationsPerInvoke = PixelCount)]
+    public void ResolveRows()
+    {
+        for (var i = 0; i < ImageHeight; i++)
+        {
+            _accumulationBuffer!.ResolveRow(i, _resolvedRow, ToneMappingOperator.Aces);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+// NOTE: End to end frames on one thread so the results are stable enough to be compared
+// with a baseline, RendererScalingBenchmark measures the thread scaling
+[MemoryDiagnoser]
+public class RendererBenchmark
+{
+    private readonly Renderer<BenchmarkImage, object?> _renderer = new(new BenchmarkImageWriter(), new RandomGenerator());
+
+    private Scene _scene = new();
+    private Camera _camera;
+    private BenchmarkImage _image;
+
+    [Params("Default", "RandomSpheres1K", "RandomSpheres16K")]
+    public string SceneName { get; set; } = string.Empty;
+
+    [Params(160, 320)]
+    public int ImageWidth { get; set; }
+
+    [Params(1, 8)]
+    public int MaxBounceCount { get; set; }
+
+    [Params(false, true)]
+    public bool IsRussianRouletteEnabled { get; set; }
+
+    [Params(RenderMode.PerPixel, RenderMode.Wavefront)]
+    public RenderMode RenderMode { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var imageHeight = ImageWidth * 9 / 16;
+
+        (_scene, var cameraPosition) = SceneName switch
+        {
+            "RandomSpheres1K" => (BenchmarkScenes.CreateRandomSpheres(1024), new Vector3(0.0f, 0.0f, -30.0f)),
+            "RandomSpheres16K" => (BenchmarkScenes.CreateRandomSpheres(16384), new Vector3(0.0f, 0.0f, -60.0f)),
+            _ => (BenchmarkScenes.CreateDefaultScene(), new Vector3(0.0f, 0.0f, -6.0f))
+        };
+
+        _scene.AccelerationStructure = BoundingVolumeHierarchy.Build(_scene.Spheres);
+        _camera = new Camera { Position = cameraPosition, AspectRatio = (float)ImageWidth / imageHeight };
+        _image = new BenchmarkImage { Width = ImageWidth, Height = imageHeight, AccumulationBuffer = new AccumulationBuffer(ImageWidth, imageHeight) };
+    }
+
+    [Benchmark]
+    public void Render()
+    {
+        _renderer.Render(_image, _scene, _camera, new RenderOptions { ThreadCount = 1, MaxBounceCount = MaxBounceCount, RussianRouletteBounceCount = IsRussianRouletteEnabled ? 3 : MaxBounceCount, RenderMode = RenderMode }, CancellationToken.None);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[Config(typeof(ThreadScalingConfig))]
+public class RendererScalingBenchmark
+{
+    private const int ImageWidth = 640;
+    private const int ImageHeight = 360;
+
+    private readonly Renderer<BenchmarkImage, object?> _renderer = new(new BenchmarkImageWriter(), new RandomGenerator());
+    private readonly Camera _camera = new() { Position = new Vector3(0.0f, 0.0f, -6.0f), AspectRatio = (float)ImageWidth / ImageHeight };
+
+    private Scene _scene = new();
+    private BenchmarkImage _image;
+
+    [ParamsSource(nameof(ThreadCounts))]
+    public int ThreadCount { get; set; }
+
+    [Params(TileOrder.Scanline, TileOrder.Morton)]
+    public TileOrder TileOrder { get; set; }
+
+    public static IEnumerable<int> ThreadCounts()
+    {
+        for (var threadCount = 1; threadCount < Environment.ProcessorCount; threadCount *= 2)
+        {
+            yield return threadCount;
+        }
+
+        yield return Environment.ProcessorCount;
+    }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _scene = BenchmarkScenes.CreateDefaultScene();
+        _image = new BenchmarkImage { Width = ImageWidth, Height = ImageHeight, AccumulationBuffer = new AccumulationBuffer(ImageWidth, ImageHeight) };
+    }
+
+    [Benchmark]
+    public void Render()
+    {
+        _renderer.Render(_image, _scene, _camera, new RenderOptions { ThreadCount = ThreadCount, TileOrder = TileOrder }, CancellationToken.None);
+    }
+}
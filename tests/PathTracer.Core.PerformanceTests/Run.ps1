@@ -1,2 +1,50 @@
-dotnet run -c Release
-dotnet run --project ../external/ResultsComparer matrix --input ./BenchmarkDotNet.Artifacts/ --base base --diff results -t 3%
\ No newline at end of file
+# Runs the benchmarks and compares the results with the stored baseline. The script fails
+# when a benchmark is slower than the baseline by more than the threshold.
+param(
+    [string]$Filter = "*",
+    [string]$Threshold = "5%",
+    [string]$Noise = "1ns",
+    [switch]$UpdateBaseline
+)
+
+try
+{
+    Push-Location $PSScriptRoot
+
+    $artifactsPath = "./BenchmarkDotNet.Artifacts"
+    $resultsPath = "$artifactsPath/results"
+    $baselinePath = "./Baseline"
+
+    if (Test-Path $resultsPath)
+    {
+        Remove-Item $resultsPath -Recurse
+    }
+
+    dotnet run -c Release -- --filter $Filter --artifacts $artifactsPath
+
+    if ($LASTEXITCODE -ne 0)
+    {
+        exit $LASTEXITCODE
+    }
+
+    if ($UpdateBaseline)
+    {
+        New-Item $baselinePath -ItemType Directory -Force | Out-Null
+        Copy-Item "$resultsPath/*-report-full.json" $baselinePath
+        exit 0
+    }
+
+    if (!(Test-Path $baselinePath))
+    {
+        Write-Host "No baseline found, run with -UpdateBaseline to create it."
+        exit 0
+    }
+
+    dotnet run -c Release --project ../../external/ResultsComparer -- --base $baselinePath --diff $resultsPath --threshold $Threshold --noise $Noise --fail-on-regression
+    exit $LASTEXITCODE
+}
+
+finally
+{
+    Pop-Location
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[MemoryDiagnoser]
+public class SceneFileBenchmark
+{
+    private readonly string _filePath = Path.Combine(Path.GetTempPath(), $"SceneFileBenchmark{SceneFile.Extension}");
+
+    private Scene _scene = new();
+
+    [Params(100_000, 1_000_000)]
+    public int PrimitiveCount { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _scene = BenchmarkScenes.CreateRandomSpheres(PrimitiveCount);
+        SceneFile.Write(_filePath, _scene, new Camera(), BoundingVolumeHierarchy.Build(_scene.Spheres));
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        File.Delete(_filePath);
+    }
+
+    // NOTE: Startup cost when the scene is already in memory but the hierarchy has to be built
+    [Benchmark(Baseline = true)]
+    public BoundingVolumeHierarchy BuildHierarchy()
+    {
+        return BoundingVolumeHierarchy.Build(_scene.Spheres);
+    }
+
+    [Benchmark]
+    public Scene ReadSceneFile()
+    {
+        return SceneFile.Read(_filePath, out _);
+    }
+}
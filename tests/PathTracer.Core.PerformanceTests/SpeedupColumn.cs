@@ -0,0 +1,69 @@
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace PathTracer.Core.PerformanceTests;
+
+// NOTE: Benchmarks using this column must have a ThreadCount parameter that includes 1
+public class SpeedupColumn : IColumn
+{
+    public const string ThreadCountParameterName = "ThreadCount";
+
+    public string Id => nameof(SpeedupColumn);
+    public string ColumnName => "Speedup";
+    public bool AlwaysShow => true;
+    public ColumnCategory Category => ColumnCategory.Custom;
+    public int PriorityInCategory => 0;
+    public bool IsNumeric => true;
+    public UnitType UnitType => UnitType.Dimensionless;
+    public string Legend => "Speedup compared to the same benchmark running on one thread";
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase)
+    {
+        return GetValue(summary, benchmarkCase, summary.Style);
+    }
+
+    public string GetValue(Summary summary, BenchmarkCase benchmarkCase, SummaryStyle style)
+    {
+        var statistics = summary[benchmarkCase]?.ResultStatistics;
+        var singleThreadCase = summary.BenchmarksCases.FirstOrDefault(item => IsSingleThreadCase(item, benchmarkCase));
+
+        if (statistics == null || singleThreadCase == null || summary[singleThreadCase]?.ResultStatistics is not { } singleThreadStatistics)
+        {
+            return "-";
+        }
+
+        var speedup = singleThreadStatistics.Mean / statistics.Mean;
+        return speedup.ToString("N2", style.CultureInfo);
+    }
+
+    public bool IsAvailable(Summary summary)
+    {
+        return true;
+    }
+
+    public bool IsDefault(Summary summary, BenchmarkCase benchmarkCase)
+    {
+        return false;
+    }
+
+    private static bool IsSingleThreadCase(BenchmarkCase item, BenchmarkCase benchmarkCase)
+    {
+        if (item.Descriptor != benchmarkCase.Descriptor)
+        {
+            return false;
+        }
+
+        foreach (var parameter in item.Parameters.Items)
+        {
+            var expectedValue = parameter.Name == ThreadCountParameterName ? 1 : benchmarkCase.Parameters[parameter.Name];
+
+            if (!Equals(parameter.Value, expectedValue))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,11 @@
+using BenchmarkDotNet.Configs;
+
+namespace PathTracer.Core.PerformanceTests;
+
+public class ThreadScalingConfig : ManualConfig
+{
+    public ThreadScalingConfig()
+    {
+        AddColumn(new SpeedupColumn());
+    }
+}
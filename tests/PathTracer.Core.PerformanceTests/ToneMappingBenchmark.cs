@@ -0,0 +1,63 @@
+using System.Numerics;
+using BenchmarkDotNet.Attributes;
+
+namespace PathTracer.Core.PerformanceTests;
+
+[MemoryDiagnoser]
+public class ToneMappingBenchmark
+{
+    private const int Width = 3840;
+    private const int Height = 2160;
+    private const int FrameCount = 4;
+
+    private Vector4[] _samples = Array.Empty<Vector4>();
+    private uint[] _imageData = Array.Empty<uint>();
+
+    [Params(ToneMappingOperator.Clamp, ToneMappingOperator.Reinhard, ToneMappingOperator.Aces)]
+    public ToneMappingOperator ToneMappingOperator { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        var random = new Random(42);
+
+        _samples = new Vector4[Width * Height];
+        _imageData = new uint[Width * Height];
+
+        for (var i = 0; i < _samples.Length; i++)
+        {
+            _samples[i] = new Vector4(random.NextSingle() * 2.0f, random.NextSingle() * 2.0f, random.NextSingle() * 2.0f, 1.0f) * FrameCount;
+        }
+    }
+
+    // NOTE: Previous per pixel implementation of the texture image writer
+    [Benchmark(Baseline = true)]
+    public uint[] PerPixel()
+    {
+        for (var i = 0; i < _samples.Length; i++)
+        {
+            var color = _samples[i] / FrameCount;
+
+            color = ToneMappingOperator switch
+            {
+                ToneMappingOperator.Reinhard => color / (Vector4.One + color),
+                ToneMappingOperator.Aces => color * (color * 2.51f + new Vector4(0.03f)) / (color * (color * 2.43f + new Vector4(0.59f)) + new Vector4(0.14f)),
+                _ => color
+            };
+
+            color = new Vector4(MathF.Pow(color.X, 1.0f / 2.2f), MathF.Pow(color.Y, 1.0f / 2.2f), MathF.Pow(color.Z, 1.0f / 2.2f), color.W);
+            color = Vector4.Clamp(color, Vector4.Zero, Vector4.One) * 255.0f;
+
+            _imageData[i] = (uint)color.W << 24 | (uint)color.Z << 16 | (uint)color.Y << 8 | (uint)color.X;
+        }
+
+        return _imageData;
+    }
+
+    [Benchmark]
+    public uint[] Vectorized()
+    {
+        ToneMapping.ResolveToRgba8(_samples, 1.0f / FrameCount, _imageData, ToneMappingOperator);
+        return _imageData;
+    }
+}
@@ -0,0 +1,328 @@
+namespace PathTracer.Core.UnitTests;
+
+public class AccumulationBufferTests
+{
+    [Fact]
+    public void AccumulateTile_ShouldOverwriteSamples_WhenFrameIsFirstAfterReset()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(4, 4);
+        var tile = new Tile { X = 0, Y = 0, Width = 4, Height = 4 };
+
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(16, new Vector4(5.0f)));
+        sut.Reset();
+
+        // Act
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(16, new Vector4(1.0f)));
+
+        // Assert
+        var result = new Vector4[16];
+        sut.Resolve(result);
+
+        Assert.All(result, pixel => Assert.Equal(new Vector4(1.0f), pixel));
+    }
+
+    [Fact]
+    public void Resolve_ShouldAverageFrames_WhenSeveralFramesAreAccumulated()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(37, 3);
+        var tile = new Tile { X = 0, Y = 0, Width = 37, Height = 3 };
+
+        // Act
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(37 * 3, new Vector4(1.0f, 2.0f, 3.0f, 1.0f)));
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(37 * 3, new Vector4(3.0f, 4.0f, 5.0f, 1.0f)));
+
+        // Assert
+        var result = new Vector4[37 * 3];
+        sut.Resolve(result);
+
+        Assert.Equal(2, sut.FrameCount);
+        Assert.All(result, pixel => Assert.Equal(new Vector4(2.0f, 3.0f, 4.0f, 1.0f), pixel));
+    }
+
+    [Fact]
+    public void ResolveRow_ShouldOnlyContainTileSamples_WhenTileIsPartial()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(8, 8);
+        var frameIndex = sut.BeginFrame();
+
+        sut.AccumulateTile(new Tile { X = 0, Y = 0, Width = 8, Height = 8 }, frameIndex, CreateSamples(64, Vector4.Zero));
+
+        // Act
+        sut.AccumulateTile(new Tile { X = 2, Y = 3, Width = 3, Height = 2 }, frameIndex, CreateSamples(6, Vector4.One));
+
+        // Assert
+        var result = new Vector4[8];
+
+        for (var i = 0; i < 8; i++)
+        {
+            sut.ResolveRow(i, result);
+
+            for (var j = 0; j < 8; j++)
+            {
+                var isInsideTile = i >= 3 && i < 5 && j >= 2 && j < 5;
+                Assert.Equal(isInsideTile ? Vector4.One : Vector4.Zero, result[j]);
+            }
+        }
+    }
+
+    [Fact]
+    public void ResolveRow_ShouldWriteRgba8Pixels_WhenDestinationIsPacked()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(5, 2);
+        var tile = new Tile { X = 0, Y = 0, Width = 5, Height = 2 };
+
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(10, new Vector4(2.0f, 0.0f, 0.0f, 1.0f)));
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(10, new Vector4(0.0f, 0.0f, 2.0f, 1.0f)));
+
+        // Act
+        var result = new uint[5];
+        sut.ResolveRow(1, result, ToneMappingOperator.Clamp);
+
+        // Assert
+        Assert.All(result, pixel => Assert.Equal(0xFFFF00FFu, pixel));
+    }
+
+    [Fact]
+    public void ComputeHash_ShouldOnlyChange_WhenSamplesAreDifferent()
+    {
+        // Arrange
+        var sut1 = new AccumulationBuffer(4, 4);
+        var sut2 = new AccumulationBuffer(4, 4);
+        var sut3 = new AccumulationBuffer(4, 4);
+        var tile = new Tile { X = 0, Y = 0, Width = 4, Height = 4 };
+
+        var samples = CreateSamples(16, Vector4.One);
+        var modifiedSamples = CreateSamples(16, Vector4.One);
+        modifiedSamples[5].Y = 1.0001f;
+
+        sut1.AccumulateTile(tile, sut1.BeginFrame(), samples);
+        sut2.AccumulateTile(tile, sut2.BeginFrame(), samples);
+        sut3.AccumulateTile(tile, sut3.BeginFrame(), modifiedSamples);
+
+        // Act
+        var result1 = sut1.ComputeHash();
+        var result2 = sut2.ComputeHash();
+        var result3 = sut3.ComputeHash();
+
+        // Assert
+        Assert.Equal(result1, result2);
+        Assert.NotEqual(result1, result3);
+    }
+
+    [Fact]
+    public void AccumulateTile_ShouldThrowArgumentException_WhenTileIsOutsideBuffer()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(8, 8);
+
+        // Act
+        var action = () => { sut.AccumulateTile(new Tile { X = 4, Y = 4, Width = 8, Height = 8 }, sut.BeginFrame(), CreateSamples(64, Vector4.One)); };
+
+        // Assert
+        Assert.Throws<ArgumentOutOfRangeException>(action);
+    }
+
+    [Fact]
+    public void UpdateConvergence_ShouldConvergeEveryBlock_WhenSamplesAreConstant()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(20, 12);
+        var tile = new Tile { X = 0, Y = 0, Width = 20, Height = 12 };
+
+        for (var i = 0; i < AccumulationBuffer.MinimumConvergenceSampleCount; i++)
+        {
+            sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(20 * 12, new Vector4(0.5f, 0.5f, 0.5f, 1.0f)));
+        }
+
+        // Act
+        var result = sut.UpdateConvergence(0.01f);
+
+        // Assert
+        Assert.Equal(0, result);
+        Assert.Equal(3 * 2, sut.BlockCount);
+        Assert.True(sut.IsConverged);
+    }
+
+    [Fact]
+    public void UpdateConvergence_ShouldNotConverge_WhenSampleCountIsBelowMinimum()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(8, 8);
+        var tile = new Tile { X = 0, Y = 0, Width = 8, Height = 8 };
+
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(64, Vector4.One));
+
+        // Act
+        var result = sut.UpdateConvergence(0.01f);
+
+        // Assert
+        Assert.Equal(1, result);
+        Assert.False(sut.IsConverged);
+    }
+
+    [Fact]
+    public void UpdateConvergence_ShouldKeepBlockActive_WhenSamplesAreNoisy()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(16, 16);
+        var tile = new Tile { X = 0, Y = 0, Width = 16, Height = 16 };
+
+        for (var i = 0; i < AccumulationBuffer.MinimumConvergenceSampleCount; i++)
+        {
+            var samples = CreateSamples(16 * 16, Vector4.One);
+
+            // Only the top right block alternates between black and white samples
+            for (var y = 0; y < 8; y++)
+            {
+                samples.AsSpan(y * 16 + 8, 8).Fill(i % 2 == 0 ? Vector4.Zero : new Vector4(2.0f));
+            }
+
+            sut.AccumulateTile(tile, sut.BeginFrame(), samples);
+        }
+
+        // Act
+        var result = sut.UpdateConvergence(0.01f);
+
+        // Assert
+        Assert.Equal(1, result);
+        Assert.Equal(3, sut.ConvergedBlockCount);
+        Assert.False(sut.IsPixelConverged(8, 0));
+        Assert.True(sut.IsPixelConverged(7, 0));
+        Assert.False(sut.IsTileConverged(tile));
+        Assert.True(sut.IsTileConverged(new Tile { X = 0, Y = 8, Width = 16, Height = 8 }));
+    }
+
+    [Fact]
+    public void AccumulateTile_ShouldIgnoreSamples_WhenBlockIsConverged()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(16, 8);
+        var tile = new Tile { X = 0, Y = 0, Width = 16, Height = 8 };
+
+        for (var i = 0; i < AccumulationBuffer.MinimumConvergenceSampleCount; i++)
+        {
+            var samples = CreateSamples(16 * 8, Vector4.One);
+
+            for (var y = 0; y < 8; y++)
+            {
+                samples.AsSpan(y * 16 + 8, 8).Fill(i % 2 == 0 ? Vector4.Zero : new Vector4(2.0f));
+            }
+
+            sut.AccumulateTile(tile, sut.BeginFrame(), samples);
+        }
+
+        sut.UpdateConvergence(0.01f);
+
+        // Act
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(16 * 8, new Vector4(10.0f)));
+
+        // Assert
+        var result = new Vector4[16];
+        sut.ResolveRow(0, result);
+
+        Assert.All(result.AsSpan(0, 8).ToArray(), pixel => Assert.Equal(Vector4.One, pixel));
+        Assert.All(result.AsSpan(8, 8).ToArray(), pixel => Assert.Equal(new Vector4(18.0f / 9.0f), pixel));
+    }
+
+    [Fact]
+    public void CopyRegion_ShouldMatchLocalRender_WhenRegionsAreRenderedSeparately()
+    {
+        // Arrange
+        var expected = new AccumulationBuffer(16, 8);
+        var sut = new AccumulationBuffer(16, 8);
+        var random = new Random(42);
+
+        var topRegion = new Tile { X = 0, Y = 4, Width = 16, Height = 4 };
+        var bottomRegion = new Tile { X = 0, Y = 0, Width = 16, Height = 4 };
+        var topBuffer = new AccumulationBuffer(16, 4);
+        var bottomBuffer = new AccumulationBuffer(16, 4);
+
+        for (var i = 0; i < 3; i++)
+        {
+            var samples = Enumerable.Range(0, 16 * 8).Select(_ => new Vector4(random.NextSingle(), random.NextSingle(), random.NextSingle(), 1.0f)).ToArray();
+
+            expected.AccumulateTile(new Tile { X = 0, Y = 0, Width = 16, Height = 8 }, expected.BeginFrame(), samples);
+            bottomBuffer.AccumulateTile(new Tile { X = 0, Y = 0, Width = 16, Height = 4 }, bottomBuffer.BeginFrame(), samples.AsSpan(0, 16 * 4));
+            topBuffer.AccumulateTile(new Tile { X = 0, Y = 0, Width = 16, Height = 4 }, topBuffer.BeginFrame(), samples.AsSpan(16 * 4, 16 * 4));
+        }
+
+        // Act
+        sut.CopyRegion(topRegion, topBuffer.FrameCount, topBuffer.Samples);
+        sut.CopyRegion(bottomRegion, bottomBuffer.FrameCount, bottomBuffer.Samples);
+
+        // Assert
+        Assert.Equal(3, sut.FrameCount);
+        Assert.Equal(expected.ComputeHash(), sut.ComputeHash());
+    }
+
+    [Fact]
+    public void CopyRegion_ShouldThrowInvalidOperationException_WhenFrameCountIsDifferent()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(8, 8);
+        sut.CopyRegion(new Tile { X = 0, Y = 0, Width = 8, Height = 4 }, 2, CreateSamples(32, Vector4.One));
+
+        // Act
+        var action = () => { sut.CopyRegion(new Tile { X = 0, Y = 4, Width = 8, Height = 4 }, 3, CreateSamples(32, Vector4.One)); };
+
+        // Assert
+        Assert.Throws<InvalidOperationException>(action);
+    }
+
+    [Fact]
+    public void ResolveFeaturesRow_ShouldAverageFeatures_WhenSeveralFramesAreAccumulated()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(4, 2, null, true);
+        var tile = new Tile { X = 0, Y = 0, Width = 4, Height = 2 };
+
+        // Act
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(8, Vector4.One), CreateFeatures(8, new PixelFeatures { Albedo = new Vector3(0.2f), Normal = Vector3.UnitX, Depth = 2.0f }));
+        sut.AccumulateTile(tile, sut.BeginFrame(), CreateSamples(8, Vector4.One), CreateFeatures(8, new PixelFeatures { Albedo = new Vector3(0.6f), Normal = Vector3.UnitY, Depth = 4.0f }));
+
+        // Assert
+        var result = new PixelFeatures[4];
+        sut.ResolveFeaturesRow(1, result);
+
+        Assert.All(result, features =>
+        {
+            Assert.Equal(0.4f, features.Albedo.X, 1e-6f);
+            Assert.Equal(new Vector3(0.5f, 0.5f, 0.0f), features.Normal);
+            Assert.Equal(3.0f, features.Depth);
+        });
+    }
+
+    [Fact]
+    public void ResolveFeaturesRow_ShouldThrowInvalidOperationException_WhenBufferHasNoFeatures()
+    {
+        // Arrange
+        var sut = new AccumulationBuffer(4, 2);
+        sut.AccumulateTile(new Tile { X = 0, Y = 0, Width = 4, Height = 2 }, sut.BeginFrame(), CreateSamples(8, Vector4.One));
+
+        // Act
+        var action = () => { sut.ResolveFeaturesRow(0, new PixelFeatures[4]); };
+
+        // Assert
+        Assert.Throws<InvalidOperationException>(action);
+    }
+
+    private static PixelFeatures[] CreateFeatures(int count, PixelFeatures value)
+    {
+        var features = new PixelFeatures[count];
+        Array.Fill(features, value);
+
+        return features;
+    }
+
+    private static Vector4[] CreateSamples(int count, Vector4 value)
+    {
+        var samples = new Vector4[count];
+        Array.Fill(samples, value);
+
+        return samples;
+    }
+}
@@ -0,0 +1,273 @@
+namespace PathTracer.Core.UnitTests;
+
+public class BoundingVolumeHierarchyTests
+{
+    [Fact]
+    public void Build_ShouldCreateEmptyHierarchy_WhenSceneIsEmpty()
+    {
+        // Act
+        var result = BoundingVolumeHierarchy.Build(new List<Sphere>());
+
+        // Assert
+        Assert.Equal(0, result.NodeCount);
+        Assert.False(result.Intersect(new Ray { Origin = Vector3.Zero, Direction = Vector3.UnitZ }, out _, out _));
+    }
+
+    [Fact]
+    public void Build_ShouldReferenceEveryPrimitiveOnce_WhenSceneIsValid()
+    {
+        // Arrange
+        var spheres = CreateRandomSpheres(1000);
+
+        // Act
+        var result = BoundingVolumeHierarchy.Build(spheres);
+
+        // Assert
+        var referencedPrimitives = new bool[spheres.Count];
+
+        foreach (var node in result.Nodes)
+        {
+            if (node.IsLeaf)
+            {
+                for (var i = node.FirstIndex; i < node.FirstIndex + node.PrimitiveCount; i++)
+                {
+                    var primitiveIndex = result.PrimitiveIndices[i];
+
+                    Assert.False(referencedPrimitives[primitiveIndex]);
+                    referencedPrimitives[primitiveIndex] = true;
+                }
+            }
+        }
+
+        Assert.DoesNotContain(false, referencedPrimitives);
+    }
+
+    [Fact]
+    public void Build_ShouldHaveParentBoundsContainingChildren_WhenSceneIsValid()
+    {
+        // Arrange
+        var spheres = CreateRandomSpheres(1000);
+
+        // Act
+        var result = BoundingVolumeHierarchy.Build(spheres);
+
+        // Assert
+        foreach (var node in result.Nodes)
+        {
+            if (!node.IsLeaf)
+            {
+                for (var i = node.FirstIndex; i < node.FirstIndex + 2; i++)
+                {
+                    var child = result.Nodes[i];
+
+                    Assert.Equal(node.BoundsMin, Vector3.Min(node.BoundsMin, child.BoundsMin));
+                    Assert.Equal(node.BoundsMax, Vector3.Max(node.BoundsMax, child.BoundsMax));
+                }
+            }
+        }
+    }
+
+    [Fact]
+    public void Intersect_ShouldReturnSameHitAsLinearScan_WhenSceneIsValid()
+    {
+        // Arrange
+        var random = new Random(42);
+        var spheres = CreateRandomSpheres(1000);
+        var sut = BoundingVolumeHierarchy.Build(spheres);
+
+        for (var i = 0; i < 1000; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 1.0f))
+            };
+
+            var (expectedDistance, expectedIndex) = IntersectLinear(spheres, ray);
+
+            // Act
+            var result = sut.Intersect(ray, out var hitDistance, out var objectIndex);
+
+            // Assert
+            Assert.Equal(expectedIndex != -1, result);
+            Assert.Equal(expectedIndex, objectIndex);
+
+            if (result)
+            {
+                Assert.Equal(expectedDistance, hitDistance, 0.0001f);
+            }
+        }
+    }
+
+    [Fact]
+    public void Refit_ShouldReturnSameHitAsLinearScan_WhenSpheresWereMoved()
+    {
+        // Arrange
+        var random = new Random(42);
+        var spheres = CreateRandomSpheres(1000);
+        var sut = BoundingVolumeHierarchy.Build(spheres);
+        var movedIndices = new[] { 0, 10, 500, 999 };
+
+        foreach (var index in movedIndices)
+        {
+            spheres[index] = spheres[index] with { Position = new Vector3(random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f, 0.0f), Radius = 2.0f };
+        }
+
+        // Act
+        sut.Refit(spheres, movedIndices);
+
+        // Assert
+        for (var i = 0; i < 1000; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 1.0f))
+            };
+
+            var (expectedDistance, expectedIndex) = IntersectLinear(spheres, ray);
+            var result = sut.Intersect(ray, out var hitDistance, out var objectIndex);
+
+            Assert.Equal(expectedIndex != -1, result);
+            Assert.Equal(expectedIndex, objectIndex);
+
+            if (result)
+            {
+                Assert.Equal(expectedDistance, hitDistance, 0.0001f);
+            }
+        }
+    }
+
+    [Fact]
+    public void Create_ShouldThrowArgumentException_WhenNodeReferencesParent()
+    {
+        // Arrange
+        var spheres = CreateRandomSpheres(100);
+        var hierarchy = BoundingVolumeHierarchy.Build(spheres);
+
+        var nodes = hierarchy.Nodes.ToArray();
+        nodes[0] = nodes[0] with { FirstIndex = 0, PrimitiveCount = 0 };
+
+        // Act
+        var action = () => { BoundingVolumeHierarchy.Create(spheres, nodes, hierarchy.PrimitiveIndices.ToArray(), hierarchy.MaxDepth); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(int.MaxValue)]
+    public void Create_ShouldThrowArgumentException_WhenMaxDepthIsDifferent(int depthOffset)
+    {
+        // Arrange
+        var spheres = CreateRandomSpheres(100);
+        var hierarchy = BoundingVolumeHierarchy.Build(spheres);
+        var maxDepth = depthOffset == int.MaxValue ? int.MaxValue : hierarchy.MaxDepth - depthOffset;
+
+        // Act
+        var action = () => { BoundingVolumeHierarchy.Create(spheres, hierarchy.Nodes.ToArray(), hierarchy.PrimitiveIndices.ToArray(), maxDepth); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    [Fact]
+    public void Create_ShouldThrowArgumentException_WhenPrimitiveIsReferencedTwice()
+    {
+        // Arrange
+        var spheres = CreateRandomSpheres(100);
+        var hierarchy = BoundingVolumeHierarchy.Build(spheres);
+
+        var primitiveIndices = hierarchy.PrimitiveIndices.ToArray();
+        primitiveIndices[1] = primitiveIndices[0];
+
+        // Act
+        var action = () => { BoundingVolumeHierarchy.Create(spheres, hierarchy.Nodes.ToArray(), primitiveIndices, hierarchy.MaxDepth); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    [Fact]
+    public void IntersectAny_ShouldFindHit_WhenClosestHitIsCloserThanDistance()
+    {
+        // Arrange
+        var random = new Random(42);
+        var spheres = CreateRandomSpheres(1000);
+        var sut = BoundingVolumeHierarchy.Build(spheres);
+
+        for (var i = 0; i < 1000; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 1.0f))
+            };
+
+            var (expectedDistance, expectedIndex) = IntersectLinear(spheres, ray);
+            var maxDistance = random.NextSingle() * 40.0f;
+            var hitDistance = maxDistance;
+            var intersectionTestCount = 0L;
+
+            // Act
+            var result = sut.IntersectAny(ray, ref hitDistance, ref intersectionTestCount);
+
+            // Assert
+            Assert.Equal(expectedIndex != -1 && expectedDistance < maxDistance, result);
+
+            if (result)
+            {
+                Assert.InRange(hitDistance, expectedDistance - 0.0001f, maxDistance);
+            }
+        }
+    }
+
+    private static List<Sphere> CreateRandomSpheres(int count)
+    {
+        var random = new Random(count);
+        var spheres = new List<Sphere>(count);
+
+        for (var i = 0; i < count; i++)
+        {
+            spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f),
+                Radius = random.NextSingle() * 0.5f + 0.01f
+            });
+        }
+
+        return spheres;
+    }
+
+    private static (float HitDistance, int ObjectIndex) IntersectLinear(List<Sphere> spheres, Ray ray)
+    {
+        var objectIndex = -1;
+        var hitDistance = float.MaxValue;
+
+        for (var i = 0; i < spheres.Count; i++)
+        {
+            var origin = ray.Origin - spheres[i].Position;
+
+            var a = Vector3.Dot(ray.Direction, ray.Direction);
+            var b = 2.0f * Vector3.Dot(origin, ray.Direction);
+            var c = Vector3.Dot(origin, origin) - spheres[i].Radius * spheres[i].Radius;
+            var discriminant = b * b - 4.0f * a * c;
+
+            if (discriminant < 0.0f)
+            {
+                continue;
+            }
+
+            var t = (-b + -MathF.Sqrt(discriminant)) / (2.0f * a);
+
+            if (t > 0 && t < hitDistance)
+            {
+                objectIndex = i;
+                hitDistance = t;
+            }
+        }
+
+        return (hitDistance, objectIndex);
+    }
+}
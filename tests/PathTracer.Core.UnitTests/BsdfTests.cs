@@ -0,0 +1,102 @@
+namespace PathTracer.Core.UnitTests;
+
+public class BsdfTests
+{
+    [Theory]
+    [InlineData(1.0f, 0.0f)]
+    [InlineData(0.5f, 0.0f)]
+    [InlineData(0.3f, 1.0f)]
+    [InlineData(0.05f, 0.5f)]
+    public void Sample_ShouldReturnValueDividedByPdf_WhenDirectionIsAboveSurface(float roughness, float metallic)
+    {
+        // Arrange
+        var random = new Random(42);
+        var material = new Material { Albedo = new Vector3(0.8f, 0.5f, 0.2f), Roughness = roughness, Metallic = metallic };
+        var normal = Vector3.Normalize(new Vector3(0.2f, 1.0f, -0.3f));
+        var outgoing = Vector3.Normalize(new Vector3(0.5f, 0.7f, 0.1f));
+
+        for (var i = 0; i < 1000; i++)
+        {
+            // Act
+            var result = Bsdf.Sample(material, normal, outgoing, new Vector3(random.NextSingle(), random.NextSingle(), random.NextSingle()), out var incoming, out var weight);
+
+            // Assert
+            if (result)
+            {
+                var expectedWeight = Bsdf.Evaluate(material, normal, outgoing, incoming) / Bsdf.GetPdf(material, normal, outgoing, incoming);
+
+                Assert.Equal(1.0f, incoming.Length(), 1e-4f);
+                Assert.True(Vector3.Distance(expectedWeight, weight) <= 1e-4f * expectedWeight.Length());
+            }
+        }
+    }
+
+    [Theory]
+    [InlineData(1.0f, 0.0f)]
+    [InlineData(0.2f, 0.0f)]
+    [InlineData(0.5f, 1.0f)]
+    public void Sample_ShouldNotReflectMoreThanIncomingLight_WhenAlbedoIsWhite(float roughness, float metallic)
+    {
+        // Arrange
+        var random = new Random(42);
+        var material = new Material { Albedo = Vector3.One, Roughness = roughness, Metallic = metallic };
+        var normal = Vector3.UnitY;
+        var outgoing = Vector3.Normalize(new Vector3(0.3f, 1.0f, 0.0f));
+        var reflectance = Vector3.Zero;
+
+        // Act
+        for (var i = 0; i < 20000; i++)
+        {
+            if (Bsdf.Sample(material, normal, outgoing, new Vector3(random.NextSingle(), random.NextSingle(), random.NextSingle()), out _, out var weight))
+            {
+                reflectance += weight;
+            }
+        }
+
+        // Assert
+        reflectance /= 20000;
+
+        Assert.InRange(reflectance.X, 0.8f, 1.01f);
+        Assert.InRange(reflectance.Y, 0.8f, 1.01f);
+    }
+
+    [Theory]
+    [InlineData(1.0f, 0.0f)]
+    [InlineData(0.5f, 0.5f)]
+    public void GetPdf_ShouldIntegrateToAtMostOne_WhenRoughnessIsHigh(float roughness, float metallic)
+    {
+        // Arrange
+        var random = new Random(42);
+        var material = new Material { Albedo = new Vector3(0.5f), Roughness = roughness, Metallic = metallic };
+        var normal = Vector3.UnitY;
+        var outgoing = Vector3.Normalize(new Vector3(0.5f, 1.0f, 0.0f));
+        var integral = 0.0;
+
+        // Act
+        for (var i = 0; i < 100000; i++)
+        {
+            var y = random.NextSingle();
+            var radius = MathF.Sqrt(1.0f - y * y);
+            var (sin, cos) = MathF.SinCos(2.0f * MathF.PI * random.NextSingle());
+
+            integral += Bsdf.GetPdf(material, normal, outgoing, new Vector3(radius * cos, y, radius * sin)) * 2.0 * Math.PI;
+        }
+
+        // Assert
+        // NOTE: Specular samples below the surface end the path so the integral can be below one
+        Assert.InRange(integral / 100000, 0.9, 1.02);
+    }
+
+    [Fact]
+    public void Evaluate_ShouldReturnZero_WhenIncomingDirectionIsBelowSurface()
+    {
+        // Arrange
+        var material = new Material { Albedo = Vector3.One, Roughness = 0.5f };
+
+        // Act
+        var result = Bsdf.Evaluate(material, Vector3.UnitY, Vector3.Normalize(new Vector3(1.0f, 1.0f, 0.0f)), Vector3.Normalize(new Vector3(-1.0f, -0.1f, 0.0f)));
+
+        // Assert
+        Assert.Equal(Vector3.Zero, result);
+    }
+}
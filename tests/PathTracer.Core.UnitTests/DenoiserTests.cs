@@ -0,0 +1,135 @@
+namespace PathTracer.Core.UnitTests;
+
+public class DenoiserTests
+{
+    [Fact]
+    public void Denoise_ShouldKeepImage_WhenSamplesAreConstant()
+    {
+        // Arrange
+        var sut = new Denoiser();
+        var source = CreateSource(37, 21, (_, _) => new Vector4(0.25f, 0.5f, 0.75f, 1.0f), (_, _) => CreateFeatures(Vector3.UnitZ, 1.0f));
+        var destination = new AccumulationBuffer(37, 21);
+
+        // Act
+        sut.Denoise(source, destination, 2, CancellationToken.None);
+
+        // Assert
+        var result = new Vector4[37 * 21];
+        destination.Resolve(result);
+
+        Assert.Equal(1, destination.FrameCount);
+        Assert.All(result, pixel =>
+        {
+            Assert.Equal(0.25f, pixel.X, 1e-4f);
+            Assert.Equal(0.5f, pixel.Y, 1e-4f);
+            Assert.Equal(0.75f, pixel.Z, 1e-4f);
+        });
+    }
+
+    [Fact]
+    public void Denoise_ShouldReduceNoise_WhenSamplesAreNoisy()
+    {
+        // Arrange
+        var sut = new Denoiser();
+        var random = new Random(42);
+        var noise = Enumerable.Range(0, 64 * 64).Select(_ => (float)random.NextDouble() - 0.5f).ToArray();
+        var source = CreateSource(64, 64, (x, y) => new Vector4(new Vector3(0.5f + noise[y * 64 + x] * 0.5f), 1.0f), (_, _) => CreateFeatures(Vector3.UnitZ, 1.0f));
+        var destination = new AccumulationBuffer(64, 64);
+
+        // Act
+        sut.Denoise(source, destination, 1, CancellationToken.None);
+
+        // Assert
+        var sourcePixels = new Vector4[64 * 64];
+        var result = new Vector4[64 * 64];
+        source.Resolve(sourcePixels);
+        destination.Resolve(result);
+
+        Assert.True(ComputeError(result, 0.5f) < ComputeError(sourcePixels, 0.5f) * 0.25f);
+    }
+
+    [Fact]
+    public void Denoise_ShouldKeepEdges_WhenNormalsAreDifferent()
+    {
+        // Arrange
+        var sut = new Denoiser();
+        var source = CreateSource(32, 32, (x, _) => x < 16 ? new Vector4(0.1f, 0.1f, 0.1f, 1.0f) : new Vector4(0.9f, 0.9f, 0.9f, 1.0f), (x, _) => CreateFeatures(x < 16 ? Vector3.UnitX : Vector3.UnitY, 1.0f));
+        var destination = new AccumulationBuffer(32, 32);
+
+        // Act
+        sut.Denoise(source, destination, 1, CancellationToken.None);
+
+        // Assert
+        var result = new Vector4[32 * 32];
+        destination.Resolve(result);
+
+        Assert.Equal(0.1f, result[16 * 32 + 15].X, 0.01f);
+        Assert.Equal(0.9f, result[16 * 32 + 16].X, 0.01f);
+    }
+
+    [Fact]
+    public void Denoise_ShouldThrowArgumentException_WhenSourceHasNoFeatures()
+    {
+        // Arrange
+        var sut = new Denoiser();
+        var source = new AccumulationBuffer(8, 8);
+        source.AccumulateTile(new Tile { X = 0, Y = 0, Width = 8, Height = 8 }, source.BeginFrame(), new Vector4[64]);
+
+        // Act
+        var action = () => { sut.Denoise(source, new AccumulationBuffer(8, 8), 1, CancellationToken.None); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    [Fact]
+    public void Denoise_ShouldThrowArgumentException_WhenDestinationSizeIsDifferent()
+    {
+        // Arrange
+        var sut = new Denoiser();
+        var source = CreateSource(8, 8, (_, _) => Vector4.One, (_, _) => CreateFeatures(Vector3.UnitZ, 1.0f));
+
+        // Act
+        var action = () => { sut.Denoise(source, new AccumulationBuffer(8, 4), 1, CancellationToken.None); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    private static AccumulationBuffer CreateSource(int width, int height, Func<int, int, Vector4> getSample, Func<int, int, PixelFeatures> getFeatures)
+    {
+        var samples = new Vector4[width * height];
+        var features = new PixelFeatures[width * height];
+
+        for (var y = 0; y < height; y++)
+        {
+            for (var x = 0; x < width; x++)
+            {
+                samples[y * width + x] = getSample(x, y);
+                features[y * width + x] = getFeatures(x, y);
+            }
+        }
+
+        var source = new AccumulationBuffer(width, height, null, true);
+        source.AccumulateTile(new Tile { X = 0, Y = 0, Width = width, Height = height }, source.BeginFrame(), samples, features);
+
+        return source;
+    }
+
+    private static PixelFeatures CreateFeatures(Vector3 normal, float depth)
+    {
+        return new PixelFeatures { Albedo = new Vector3(0.5f), Normal = normal, Depth = depth };
+    }
+
+    private static float ComputeError(Vector4[] pixels, float expectedValue)
+    {
+        var error = 0.0f;
+
+        foreach (var pixel in pixels)
+        {
+            error += (pixel.X - expectedValue) * (pixel.X - expectedValue);
+        }
+
+        return MathF.Sqrt(error / pixels.Length);
+    }
+}
@@ -0,0 +1,146 @@
+namespace PathTracer.Core.UnitTests;
+
+public class InstanceAccelerationStructureTests
+{
+    [Fact]
+    public void Intersect_ShouldReturnSameHitAsFlatScene_WhenInstancesAreTransformed()
+    {
+        // Arrange
+        var random = new Random(42);
+        var geometries = new List<GeometryBlock> { CreateBlock(random, 10), CreateBlock(random, 5) };
+        var instances = new List<Instance>();
+        var spheres = new List<Sphere>();
+        var sphereInstances = new List<(int InstanceIndex, int ObjectIndex)>();
+
+        for (var i = 0; i < 200; i++)
+        {
+            var instance = new Instance
+            {
+                GeometryIndex = i % geometries.Count,
+                Position = new Vector3(random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f),
+                Rotation = Quaternion.CreateFromYawPitchRoll(random.NextSingle() * 6.0f, random.NextSingle() * 6.0f, random.NextSingle() * 6.0f),
+                Scale = random.NextSingle() * 1.5f + 0.25f
+            };
+
+            instances.Add(instance);
+
+            var block = geometries[instance.GeometryIndex].Spheres;
+
+            for (var j = 0; j < block.Count; j++)
+            {
+                spheres.Add(new Sphere
+                {
+                    Position = instance.Position + Vector3.Transform(block[j].Position * instance.Scale, instance.Rotation),
+                    Radius = block[j].Radius * instance.Scale
+                });
+
+                sphereInstances.Add((i, j));
+            }
+        }
+
+        var flatHierarchy = BoundingVolumeHierarchy.Build(spheres);
+        var sut = InstanceAccelerationStructure.Build(geometries, instances);
+
+        for (var i = 0; i < 1000; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 1.0f))
+            };
+
+            var isExpectedHit = flatHierarchy.Intersect(ray, out var expectedDistance, out var expectedIndex);
+
+            // Act
+            var result = sut.Intersect(ray, out var hitDistance, out var instanceIndex, out var objectIndex);
+
+            // Assert
+            Assert.Equal(isExpectedHit, result);
+
+            if (result)
+            {
+                Assert.Equal(sphereInstances[expectedIndex], (instanceIndex, objectIndex));
+                Assert.Equal(expectedDistance, hitDistance, 0.01f);
+            }
+        }
+    }
+
+    [Fact]
+    public void IntersectClosest_ShouldKeepCloserHit_WhenInstancesAreBehindIt()
+    {
+        // Arrange
+        var geometries = new List<GeometryBlock> { new([new Sphere { Radius = 1.0f }]) };
+        var instances = new List<Instance> { new() { Position = new Vector3(0.0f, 0.0f, 10.0f) } };
+        var sut = InstanceAccelerationStructure.Build(geometries, instances);
+
+        var ray = new Ray { Origin = Vector3.Zero, Direction = Vector3.UnitZ };
+        var hitDistance = 5.0f;
+        var instanceIndex = -1;
+        var objectIndex = 3;
+        var intersectionTestCount = 0L;
+
+        // Act
+        var result = sut.IntersectClosest(ray, ref hitDistance, ref instanceIndex, ref objectIndex, ref intersectionTestCount);
+
+        // Assert
+        Assert.False(result);
+        Assert.Equal(5.0f, hitDistance);
+        Assert.Equal(-1, instanceIndex);
+        Assert.Equal(3, objectIndex);
+    }
+
+    [Fact]
+    public void IntersectAny_ShouldOnlyFindHits_WhenTheyAreCloserThanDistance()
+    {
+        // Arrange
+        var geometries = new List<GeometryBlock> { new([new Sphere { Radius = 1.0f }]) };
+        var instances = new List<Instance> { new() { Position = new Vector3(0.0f, 0.0f, 10.0f), Scale = 2.0f } };
+        var sut = InstanceAccelerationStructure.Build(geometries, instances);
+
+        var ray = new Ray { Origin = Vector3.Zero, Direction = Vector3.UnitZ };
+        var nearHitDistance = 7.0f;
+        var farHitDistance = 9.0f;
+        var intersectionTestCount = 0L;
+
+        // Act
+        var nearResult = sut.IntersectAny(ray, ref nearHitDistance, ref intersectionTestCount);
+        var farResult = sut.IntersectAny(ray, ref farHitDistance, ref intersectionTestCount);
+
+        // Assert
+        Assert.False(nearResult);
+        Assert.Equal(7.0f, nearHitDistance);
+        Assert.True(farResult);
+        Assert.Equal(8.0f, farHitDistance, 0.001f);
+        Assert.True(intersectionTestCount > 0);
+    }
+
+    [Fact]
+    public void Build_ShouldThrowArgumentException_WhenInstanceGeometryIsMissing()
+    {
+        // Arrange
+        var geometries = new List<GeometryBlock> { new([new Sphere()]) };
+        var instances = new List<Instance> { new() { GeometryIndex = 1 } };
+
+        // Act
+        var action = () => { InstanceAccelerationStructure.Build(geometries, instances); };
+
+        // Assert
+        Assert.Throws<ArgumentException>(action);
+    }
+
+    private static GeometryBlock CreateBlock(Random random, int sphereCount)
+    {
+        var block = new GeometryBlock();
+
+        for (var i = 0; i < sphereCount; i++)
+        {
+            block.Spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() * 2.0f - 1.0f, random.NextSingle() * 2.0f - 1.0f, random.NextSingle() * 2.0f - 1.0f),
+                Radius = random.NextSingle() * 0.3f + 0.05f
+            });
+        }
+
+        return block;
+    }
+}
\ No newline at end of file
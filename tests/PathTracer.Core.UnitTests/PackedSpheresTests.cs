@@ -0,0 +1,80 @@
+namespace PathTracer.Core.UnitTests;
+
+public class PackedSpheresTests
+{
+    [Fact]
+    public void Create_ShouldPackSphereComponents_WhenSceneIsValid()
+    {
+        // Arrange
+        var scene = new Scene();
+        scene.Spheres.Add(new Sphere { Position = new Vector3(1.0f, 2.0f, 3.0f), Radius = 2.0f });
+        scene.Spheres.Add(new Sphere { Position = new Vector3(4.0f, 5.0f, 6.0f), Radius = 0.5f });
+
+        // Act
+        var result = PackedSpheres.Create(scene);
+
+        // Assert
+        Assert.Equal(2, result.Count);
+        Assert.Equal(new[] { 1.0f, 4.0f }, result.PositionsX.ToArray());
+        Assert.Equal(new[] { 2.0f, 5.0f }, result.PositionsY.ToArray());
+        Assert.Equal(new[] { 3.0f, 6.0f }, result.PositionsZ.ToArray());
+        Assert.Equal(new[] { 4.0f, 0.25f }, result.RadiiSquared.ToArray());
+        Assert.Equal(new[] { 0, 1 }, result.ObjectIndices.ToArray());
+    }
+
+    [Fact]
+    public void Intersect_ShouldReturnFalse_WhenSceneIsEmpty()
+    {
+        // Arrange
+        var sut = PackedSpheres.Create(new Scene());
+
+        // Act
+        var result = sut.Intersect(new Ray { Origin = Vector3.Zero, Direction = Vector3.UnitZ }, out _, out var objectIndex);
+
+        // Assert
+        Assert.False(result);
+        Assert.Equal(-1, objectIndex);
+    }
+
+    [Theory]
+    [InlineData(2)]
+    [InlineData(7)]
+    [InlineData(1000)]
+    public void Intersect_ShouldReturnSameHitAsScalarPath_WhenSceneIsValid(int sphereCount)
+    {
+        // Arrange
+        var random = new Random(sphereCount);
+        var scene = new Scene();
+
+        for (var i = 0; i < sphereCount; i++)
+        {
+            scene.Spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f),
+                Radius = random.NextSingle() * 2.0f + 0.01f
+            });
+        }
+
+        var sut = PackedSpheres.Create(scene);
+
+        for (var i = 0; i < 1000; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.Normalize(new Vector3(random.NextSingle() - 0.5f, random.NextSingle() - 0.5f, 1.0f))
+            };
+
+            var expectedDistance = float.MaxValue;
+            var expectedIndex = -1;
+            sut.IntersectScalar(ray, 0, sut.Count, ref expectedDistance, ref expectedIndex);
+
+            // Act
+            sut.Intersect(ray, out var hitDistance, out var objectIndex);
+
+            // Assert
+            Assert.Equal(expectedIndex, objectIndex);
+            Assert.Equal(expectedDistance, hitDistance);
+        }
+    }
+}
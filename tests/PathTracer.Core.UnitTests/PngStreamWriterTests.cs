@@ -0,0 +1,176 @@
+using System.Buffers.Binary;
+using System.IO.Compression;
+using System.Runtime.InteropServices;
+
+namespace PathTracer.Core.UnitTests;
+
+public class PngStreamWriterTests
+{
+    [Fact]
+    public void WriteRow_ShouldEncodeSamePixels_WhenImageIsDecoded()
+    {
+        // Arrange
+        const int width = 300;
+        const int height = 200;
+
+        var random = new Random(42);
+        var pixels = new uint[width * height];
+        random.NextBytes(MemoryMarshal.AsBytes(pixels.AsSpan()));
+
+        using var stream = new MemoryStream();
+
+        // Act
+        using (var sut = new PngStreamWriter(stream, width, height))
+        {
+            for (var i = 0; i < height; i++)
+            {
+                sut.WriteRow(pixels.AsSpan(i * width, width));
+            }
+        }
+
+        // Assert
+        var chunks = ReadChunks(stream.ToArray());
+
+        Assert.Equal("IHDR", chunks[0].Type);
+        Assert.Equal(width, BinaryPrimitives.ReadInt32BigEndian(chunks[0].Data));
+        Assert.Equal(height, BinaryPrimitives.ReadInt32BigEndian(chunks[0].Data.AsSpan(4)));
+        Assert.Equal("IEND", chunks[^1].Type);
+
+        // Random pixels don't compress so the image data is split in several chunks
+        var imageDataChunks = chunks.Where(chunk => chunk.Type == "IDAT").ToArray();
+        Assert.True(imageDataChunks.Length > 1);
+
+        Assert.Equal(pixels, DecodePixels(imageDataChunks, width, height));
+    }
+
+    [Fact]
+    public void WriteRows_ShouldWriteTopRowFirst_WhenAccumulationBufferIsWritten()
+    {
+        // Arrange
+        var accumulationBuffer = new AccumulationBuffer(16, 2);
+        var samples = new Vector4[32];
+
+        samples.AsSpan(0, 16).Fill(new Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+        samples.AsSpan(16, 16).Fill(Vector4.One);
+        accumulationBuffer.AccumulateTile(new Tile { X = 0, Y = 0, Width = 16, Height = 2 }, accumulationBuffer.BeginFrame(), samples);
+
+        using var stream = new MemoryStream();
+
+        // Act
+        using (var sut = new PngStreamWriter(stream, 16, 2))
+        {
+            sut.WriteRows(accumulationBuffer, ToneMappingOperator.Clamp);
+        }
+
+        // Assert
+        var result = DecodePixels(ReadChunks(stream.ToArray()).Where(chunk => chunk.Type == "IDAT").ToArray(), 16, 2);
+
+        Assert.All(result.AsSpan(0, 16).ToArray(), pixel => Assert.Equal(0xFFFFFFFF, pixel));
+        Assert.All(result.AsSpan(16, 16).ToArray(), pixel => Assert.Equal(0xFF000000, pixel));
+    }
+
+    [Fact]
+    public void WriteRow_ShouldThrowInvalidOperationException_WhenEveryRowWasWritten()
+    {
+        // Arrange
+        using var stream = new MemoryStream();
+        using var sut = new PngStreamWriter(stream, 4, 1);
+        var pixels = new uint[4];
+
+        sut.WriteRow(pixels);
+
+        // Act
+        var action = () => { sut.WriteRow(pixels); };
+
+        // Assert
+        Assert.Throws<InvalidOperationException>(action);
+    }
+
+    [Theory]
+    [InlineData(false)]
+    [InlineData(true)]
+    public void Dispose_ShouldCloseStream_WhenStreamIsNotLeftOpen(bool leaveOpen)
+    {
+        // Arrange
+        using var stream = new MemoryStream();
+        var sut = new PngStreamWriter(stream, 4, 1, leaveOpen: leaveOpen);
+
+        sut.WriteRow(new uint[4]);
+
+        // Act
+        sut.Dispose();
+
+        // Assert
+        Assert.Equal(leaveOpen, stream.CanWrite);
+        Assert.Equal("IEND", ReadChunks(stream.ToArray())[^1].Type);
+    }
+
+    private static List<(string Type, byte[] Data)> ReadChunks(byte[] data)
+    {
+        var chunks = new List<(string Type, byte[] Data)>();
+
+        Assert.Equal(new byte[] { 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A }, data[..8]);
+
+        for (var offset = 8; offset < data.Length;)
+        {
+            var length = BinaryPrimitives.ReadInt32BigEndian(data.AsSpan(offset));
+            var type = System.Text.Encoding.ASCII.GetString(data, offset + 4, 4);
+            var chunkData = data.AsSpan(offset + 8, length).ToArray();
+            var crc = BinaryPrimitives.ReadUInt32BigEndian(data.AsSpan(offset + 8 + length));
+
+            Assert.Equal(ComputeCrc(data.AsSpan(offset + 4, length + 4)), crc);
+
+            chunks.Add((type, chunkData));
+            offset += length + 12;
+        }
+
+        return chunks;
+    }
+
+    private static uint[] DecodePixels((string Type, byte[] Data)[] imageDataChunks, int width, int height)
+    {
+        using var compressedStream = new MemoryStream(imageDataChunks.SelectMany(chunk => chunk.Data).ToArray());
+        using var decompressionStream = new ZLibStream(compressedStream, CompressionMode.Decompress);
+        using var decompressedStream = new MemoryStream();
+
+        decompressionStream.CopyTo(decompressedStream);
+
+        var data = decompressedStream.ToArray();
+        var pixels = new uint[width * height];
+        var pixelBytes = MemoryMarshal.AsBytes(pixels.AsSpan());
+
+        Assert.Equal((width * 4 + 1) * height, data.Length);
+
+        for (var i = 0; i < height; i++)
+        {
+            var row = data.AsSpan(i * (width * 4 + 1), width * 4 + 1);
+            var destination = pixelBytes.Slice(i * width * 4, width * 4);
+
+            Assert.Equal(1, row[0]);
+
+            for (var j = 0; j < width * 4; j++)
+            {
+                destination[j] = (byte)(row[j + 1] + (j >= 4 ? destination[j - 4] : 0));
+            }
+        }
+
+        return pixels;
+    }
+
+    private static uint ComputeCrc(ReadOnlySpan<byte> data)
+    {
+        var crc = uint.MaxValue;
+
+        foreach (var value in data)
+        {
+            crc ^= value;
+
+            for (var i = 0; i < 8; i++)
+            {
+                crc = (crc & 1) != 0 ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+            }
+        }
+
+        return ~crc;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+namespace PathTracer.Core.UnitTests;
+
+public class PrimaryRayCacheTests
+{
+    private const int ImageWidth = 64;
+    private const int ImageHeight = 48;
+
+    private readonly Camera _camera;
+    private readonly PrimaryRayCache _sut;
+
+    public PrimaryRayCacheTests()
+    {
+        _camera = new Camera { Position = new Vector3(1.0f, 2.0f, -5.0f), Target = new Vector3(0.5f, 0.0f, 1.0f), AspectRatio = (float)ImageWidth / ImageHeight };
+        _sut = new PrimaryRayCache(_camera, ImageWidth, ImageHeight);
+    }
+
+    [Theory]
+    [InlineData(0, 0)]
+    [InlineData(32, 24)]
+    [InlineData(63, 0)]
+    [InlineData(17, 47)]
+    public void GenerateRay_ShouldMatchRayGenerator_WhenJitterIsZero(int x, int y)
+    {
+        // Arrange
+        var pixelCoordinates = new Vector2((float)x / ImageWidth, (float)y / ImageHeight) * 2.0f - Vector2.One;
+        var expected = new RayGenerator(_camera).GenerateRay(pixelCoordinates);
+
+        // Act
+        var result = _sut.GenerateRay(x, y, Vector2.Zero);
+
+        // Assert
+        Assert.Equal(expected.Origin, result.Origin);
+        Assert.True(Vector3.Distance(expected.Direction, result.Direction) < 1e-5f);
+    }
+
+    [Fact]
+    public void GenerateRay_ShouldReachNextPixel_WhenJitterIsOne()
+    {
+        // Act
+        var result = _sut.GenerateRay(10, 20, Vector2.One);
+
+        // Assert
+        var expected = _sut.GenerateRay(11, 21, Vector2.Zero);
+        Assert.True(Vector3.Distance(expected.Direction, result.Direction) < 1e-6f);
+    }
+
+    [Fact]
+    public void GenerateRay_ShouldMatchPixelRay_WhenGeneratedFromRowDirection()
+    {
+        // Arrange
+        var jitter = new Vector2(0.25f, 0.75f);
+        var rowDirection = _sut.GetRowDirection(8, 30);
+
+        // Act
+        var result = _sut.GenerateRay(rowDirection, 5, jitter);
+
+        // Assert
+        var expected = _sut.GenerateRay(13, 30, jitter);
+        Assert.True(Vector3.Distance(expected.Direction, result.Direction) < 1e-6f);
+        Assert.Equal(1.0f, result.Direction.Length(), 5);
+    }
+
+    [Fact]
+    public void Matches_ShouldReturnFalse_WhenCameraOrSizeChanges()
+    {
+        // Act
+        var sameResult = _sut.Matches(_camera, ImageWidth, ImageHeight);
+        var movedResult = _sut.Matches(_camera with { Position = Vector3.Zero }, ImageWidth, ImageHeight);
+        var resizedResult = _sut.Matches(_camera, ImageWidth / 2, ImageHeight);
+
+        // Assert
+        Assert.True(sameResult);
+        Assert.False(movedResult);
+        Assert.False(resizedResult);
+    }
+}
\ No newline at end of file
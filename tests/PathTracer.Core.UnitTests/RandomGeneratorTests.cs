@@ -0,0 +1,114 @@
+namespace PathTracer.Core.UnitTests;
+
+public class RandomGeneratorTests
+{
+    [Fact]
+    public void GetVector3_ShouldReturnSameSequence_WhenPixelAndSampleAreSame()
+    {
+        // Arrange
+        var sut = new RandomGenerator();
+        var state1 = sut.CreateState(1234, 7);
+        var state2 = sut.CreateState(1234, 7);
+
+        // Act
+        var result1 = new[] { sut.GetVector3(ref state1), sut.GetVector3(ref state1), sut.GetVector3(ref state1) };
+        var result2 = new[] { sut.GetVector3(ref state2), sut.GetVector3(ref state2), sut.GetVector3(ref state2) };
+
+        // Assert
+        Assert.Equal(result1, result2);
+    }
+
+    [Fact]
+    public void GetVector3_ShouldReturnDifferentValues_WhenPixelOrSampleIsDifferent()
+    {
+        // Arrange
+        var sut = new RandomGenerator();
+        var state = sut.CreateState(1234, 7);
+        var nextPixelState = sut.CreateState(1235, 7);
+        var nextSampleState = sut.CreateState(1234, 8);
+
+        // Act
+        var result = sut.GetVector3(ref state);
+        var nextPixelResult = sut.GetVector3(ref nextPixelState);
+        var nextSampleResult = sut.GetVector3(ref nextSampleState);
+
+        // Assert
+        Assert.NotEqual(result, nextPixelResult);
+        Assert.NotEqual(result, nextSampleResult);
+    }
+
+    [Theory]
+    [InlineData(typeof(RandomGenerator))]
+    [InlineData(typeof(LowDiscrepancyRandomGenerator))]
+    public void GetVector3_ShouldBeUniformInUnitCube_WhenManySamplesAreDrawn(Type randomGeneratorType)
+    {
+        // Arrange
+        const int bucketCount = 16;
+        const int sampleCount = 16384;
+
+        var sut = (IRandomGenerator)Activator.CreateInstance(randomGeneratorType)!;
+        var buckets = new int[bucketCount];
+
+        // Act
+        for (var i = 0; i < sampleCount; i++)
+        {
+            var state = sut.CreateState(42, i);
+            var vector = sut.GetVector3(ref state);
+
+            Assert.InRange(vector.X, -0.5f, 0.5f);
+            Assert.InRange(vector.Y, -0.5f, 0.5f);
+            Assert.InRange(vector.Z, -0.5f, 0.5f);
+
+            buckets[(int)((vector.X + 0.5f) * bucketCount)]++;
+        }
+
+        // Assert
+        var expectedCount = (double)sampleCount / bucketCount;
+        var chiSquare = buckets.Sum(count => (count - expectedCount) * (count - expectedCount) / expectedCount);
+
+        // NOTE: 30.6 is the 99% quantile of the chi-square distribution with 15 degrees of freedom
+        Assert.InRange(chiSquare, 0.0, 30.6);
+    }
+
+    [Fact]
+    public void GetVector3_ShouldConvergeFaster_WhenUsingLowDiscrepancySequence()
+    {
+        // Arrange
+        const int pixelCount = 64;
+        const int sampleCount = 256;
+
+        // Integral of x^2 + y^2 + z^2 over the [-0.5, 0.5] cube
+        const double expected = 0.25;
+
+        // Act
+        var randomError = ComputeIntegrationError(new RandomGenerator(), pixelCount, sampleCount, expected);
+        var lowDiscrepancyError = ComputeIntegrationError(new LowDiscrepancyRandomGenerator(), pixelCount, sampleCount, expected);
+
+        // Assert
+        Assert.InRange(randomError, 0.0, 0.01);
+        Assert.InRange(lowDiscrepancyError, 0.0, randomError / 4.0);
+    }
+
+    private static double ComputeIntegrationError(IRandomGenerator randomGenerator, int pixelCount, int sampleCount, double expected)
+    {
+        var squaredError = 0.0;
+
+        for (var i = 0; i < pixelCount; i++)
+        {
+            var sum = 0.0;
+
+            for (var j = 0; j < sampleCount; j++)
+            {
+                var state = randomGenerator.CreateState(i, j);
+                var vector = randomGenerator.GetVector3(ref state);
+
+                sum += vector.LengthSquared();
+            }
+
+            var error = sum / sampleCount - expected;
+            squaredError += error * error;
+        }
+
+        return Math.Sqrt(squaredError / pixelCount);
+    }
+}
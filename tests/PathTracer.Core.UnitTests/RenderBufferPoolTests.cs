@@ -0,0 +1,67 @@
+namespace PathTracer.Core.UnitTests;
+
+public class RenderBufferPoolTests
+{
+    [Theory]
+    [InlineData(1)]
+    [InlineData(1000)]
+    [InlineData(1280 * 720)]
+    [InlineData(1281 * 721)]
+    public void Rent_ShouldReturnArrayWithAtLeastRequestedLength_WhenPoolIsEmpty(int length)
+    {
+        // Arrange
+        var sut = new RenderBufferPool(long.MaxValue);
+
+        // Act
+        var result = sut.Rent<uint>(length);
+
+        // Assert
+        Assert.InRange(result.Length, length, Math.Max(length * 5 / 4 + 1024, 1024));
+    }
+
+    [Fact]
+    public void Rent_ShouldReuseReturnedArray_WhenSizeIsClose()
+    {
+        // Arrange
+        var sut = new RenderBufferPool(long.MaxValue);
+        var array = sut.Rent<Vector4>(1280 * 720);
+        sut.Return(array);
+
+        // Act
+        var result = sut.Rent<Vector4>(1270 * 715);
+
+        // Assert
+        Assert.Same(array, result);
+        Assert.Equal(0, sut.RetainedByteCount);
+    }
+
+    [Fact]
+    public void Return_ShouldDropArray_WhenArrayWasNotRentedFromPool()
+    {
+        // Arrange
+        var sut = new RenderBufferPool(long.MaxValue);
+
+        // Act
+        sut.Return(new uint[1280 * 720]);
+
+        // Assert
+        Assert.Equal(0, sut.RetainedByteCount);
+    }
+
+    [Fact]
+    public void Return_ShouldDropArray_WhenRetainedMemoryIsAboveLimit()
+    {
+        // Arrange
+        var sut = new RenderBufferPool(4096 * sizeof(uint));
+        var array = sut.Rent<uint>(4096);
+        var otherArray = sut.Rent<uint>(4096);
+
+        // Act
+        sut.Return(array);
+        sut.Return(otherArray);
+
+        // Assert
+        Assert.Equal(4096 * sizeof(uint), sut.RetainedByteCount);
+        Assert.NotSame(otherArray, sut.Rent<uint>(4096));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+namespace PathTracer.Core.UnitTests;
+
+public class RenderCountersTests
+{
+    [Fact]
+    public void GetValues_ShouldReturnTotals_WhenValuesAreAddedFromManyThreads()
+    {
+        // Arrange
+        var sut = new RenderCounters();
+
+        // Act
+        Parallel.For(0, 1000, _ =>
+        {
+            sut.Add(new RenderCounterValues { RayCount = 3, SampleCount = 1, IntersectionTestCount = 5, HitCount = 2, MissCount = 1 });
+        });
+
+        // Assert
+        var result = sut.GetValues();
+
+        Assert.Equal(3000, result.RayCount);
+        Assert.Equal(1000, result.SampleCount);
+        Assert.Equal(5000, result.IntersectionTestCount);
+        Assert.Equal(3.0, result.BouncesPerPath);
+        Assert.Equal(2.0 / 3.0, result.HitRatio, 6);
+    }
+
+    [Fact]
+    public void Reset_ShouldClearValues_WhenValuesWereAdded()
+    {
+        // Arrange
+        var sut = new RenderCounters();
+        sut.Add(new RenderCounterValues { RayCount = 3, SampleCount = 1, RenderTicks = 100 });
+
+        // Act
+        sut.Reset();
+
+        // Assert
+        Assert.Equal(new RenderCounterValues(), sut.GetValues());
+    }
+}
\ No newline at end of file
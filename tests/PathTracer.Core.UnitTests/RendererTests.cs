@@ -12,6 +12,7 @@ public class RendererTests
     private readonly IImageWriter<IImage, TestParameter> _mockImageWriter;
     private readonly Camera _camera;
     private readonly Scene _scene;
+    private readonly AccumulationBuffer _accumulationBuffer;
 
     public RendererTests()
     {
@@ -19,6 +20,8 @@ public class RendererTests
         _mockImageWriter = Substitute.For<IImageWriter<IImage, TestParameter>>();
         _camera = new Camera();
         _scene = new Scene();
+        _accumulationBuffer = new AccumulationBuffer(100, 100);
+        _mockImage.AccumulationBuffer.Returns(_accumulationBuffer);
 
         _sut = new Renderer<IImage, TestParameter>(_mockImageWriter, new RandomGenerator());
     }
@@ -33,24 +36,30 @@ public class RendererTests
         _mockImage.Height.Returns(imageHeight);
 
         // Act
-        var action = () => { _sut.Render(_mockImage, _scene, _camera); };
+        var action = () => { _sut.Render(_mockImage, _scene, _camera, new RenderOptions(), CancellationToken.None); };
 
         // Assert
         Assert.Throws<ArgumentOutOfRangeException>(action);
     }
 
-    [Fact]
-    public void Render_ShouldWriteEveryPixels_WhenDataIsValid()
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldWriteEveryPixels_WhenDataIsValid(RenderMode renderMode)
     {
         // Arrange
         _mockImage.Width.Returns(100);
         _mockImage.Height.Returns(100);
 
         // Act
-        _sut.Render(_mockImage, _scene, _camera);
+        _sut.Render(_mockImage, _scene, _camera, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
 
         // Assert
-        _mockImageWriter.Received(100 * 100).StorePixel(_mockImage, Arg.Any<int>(), Arg.Any<int>(), Arg.Any<Vector4>());
+        var resolvedImage = new Vector4[100 * 100];
+        _accumulationBuffer.Resolve(resolvedImage);
+
+        Assert.Equal(1, _accumulationBuffer.FrameCount);
+        Assert.All(resolvedImage, pixel => Assert.Equal(1.0f, pixel.W));
     }
 
     [Fact]
@@ -66,17 +75,351 @@ public class RendererTests
         _mockImageWriter.Received().CommitImage(_mockImage, testParameter);
     }
     
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldHaveEmptyImage_WhenNothingIsVisible(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        // Act
+        _sut.Render(_mockImage, _scene, _camera with { Position = Vector3.Zero }, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
+
+        // Assert
+        var resolvedImage = new Vector4[100 * 100];
+        _accumulationBuffer.Resolve(resolvedImage);
+
+        Assert.All(resolvedImage, pixel => Assert.Equal(new Vector4(0.6f, 0.7f, 0.9f, 1.0f), pixel));
+    }
+
+    [Fact]
+    public void Render_ShouldThrowOperationCanceledException_WhenTokenIsCanceled()
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        using var cancellationTokenSource = new CancellationTokenSource();
+        cancellationTokenSource.Cancel();
+
+        // Act
+        var action = () => { _sut.Render(_mockImage, _scene, _camera, new RenderOptions(), cancellationTokenSource.Token); };
+
+        // Assert
+        Assert.ThrowsAny<OperationCanceledException>(action);
+        Assert.Equal(0, _accumulationBuffer.FrameCount);
+    }
+
     [Fact]
-    public void Render_ShouldHaveEmptyImage_WhenNothingIsVisible()
+    public void Render_ShouldAverageFrames_WhenRenderedSeveralTimes()
     {
         // Arrange
         _mockImage.Width.Returns(100);
         _mockImage.Height.Returns(100);
 
         // Act
-        _sut.Render(_mockImage, _scene, _camera with { Position = Vector3.Zero });
+        for (var i = 0; i < 3; i++)
+        {
+            _sut.Render(_mockImage, _scene, _camera with { Position = Vector3.Zero }, new RenderOptions(), CancellationToken.None);
+        }
+
+        // Assert
+        var resolvedImage = new Vector4[100 * 100];
+        _accumulationBuffer.Resolve(resolvedImage);
+
+        Assert.Equal(3, _accumulationBuffer.FrameCount);
+        Assert.All(resolvedImage, pixel => Assert.True(Vector4.Distance(new Vector4(0.6f, 0.7f, 0.9f, 1.0f), pixel) < 0.0001f));
+    }
+
+    [Fact]
+    public void Render_ShouldProduceIdenticalImages_WhenSchedulingIsDifferent()
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        var otherAccumulationBuffer = new AccumulationBuffer(100, 100);
+        var otherImage = Substitute.For<IImage>();
+        otherImage.Width.Returns(100);
+        otherImage.Height.Returns(100);
+        otherImage.AccumulationBuffer.Returns(otherAccumulationBuffer);
+
+        _scene.Materials.Add(new Material { Albedo = new Vector3(1.0f, 0.5f, 0.2f), Roughness = 0.5f });
+        _scene.Spheres.Add(new Sphere { Position = Vector3.Zero, Radius = 1.0f, MaterialIndex = 0 });
+
+        var camera = _camera with { Position = new Vector3(0.0f, 0.0f, -4.0f) };
+        var renderOptions = new RenderOptions { RenderMode = RenderMode.PerPixel, ThreadCount = 1, TileSize = 8, TileOrder = TileOrder.Scanline };
+        var otherRenderOptions = new RenderOptions { RenderMode = RenderMode.Wavefront, ThreadCount = 4, TileSize = 32, TileOrder = TileOrder.Spiral };
+
+        // Act
+        for (var i = 0; i < 2; i++)
+        {
+            _sut.Render(_mockImage, _scene, camera, renderOptions, CancellationToken.None);
+            _sut.Render(otherImage, _scene, camera, otherRenderOptions, CancellationToken.None);
+        }
 
         // Assert
-        _mockImageWriter.Received(100 * 100).StorePixel(_mockImage, Arg.Any<int>(), Arg.Any<int>(), new Vector4(0.6f, 0.7f, 0.9f, 1.0f));
+        Assert.Equal(_accumulationBuffer.ComputeHash(), otherAccumulationBuffer.ComputeHash());
     }
-}
\ No newline at end of file
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldCountOneRayPerSample_WhenNothingIsVisible(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        // Act
+        _sut.Render(_mockImage, _scene, _camera, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
+
+        // Assert
+        Assert.Equal(100 * 100, _sut.Counters.SampleCount);
+        Assert.Equal(100 * 100, _sut.Counters.RayCount);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldCountEveryRayAsHitOrMiss_WhenSphereIsVisible(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        _scene.Materials.Add(new Material { Albedo = new Vector3(1.0f, 0.5f, 0.2f), Roughness = 0.5f });
+        _scene.Spheres.Add(new Sphere { Position = Vector3.Zero, Radius = 1.0f, MaterialIndex = 0 });
+
+        var camera = _camera with { Position = new Vector3(0.0f, 0.0f, -4.0f) };
+
+        // Act
+        _sut.Render(_mockImage, _scene, camera, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
+
+        // Assert
+        var result = _sut.Counters.GetValues();
+
+        Assert.Equal(result.RayCount, result.HitCount + result.MissCount);
+        Assert.Equal(100 * 100, result.SampleCount);
+        Assert.True(result.HitCount > 0);
+        Assert.True(result.IntersectionTestCount >= result.HitCount);
+        Assert.True(result.BouncesPerPath > 1.0);
+        Assert.True(result.RenderTicks > 0);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldShortenPaths_WhenRussianRouletteIsEnabled(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        var scene = CreateSphereGridScene();
+        var camera = _camera with { Position = new Vector3(0.5f) };
+        var otherRenderer = new Renderer<IImage, TestParameter>(_mockImageWriter, new RandomGenerator());
+        var otherAccumulationBuffer = new AccumulationBuffer(100, 100);
+        var otherImage = Substitute.For<IImage>();
+        otherImage.Width.Returns(100);
+        otherImage.Height.Returns(100);
+        otherImage.AccumulationBuffer.Returns(otherAccumulationBuffer);
+
+        // Act
+        _sut.Render(_mockImage, scene, camera, new RenderOptions { RenderMode = renderMode, MaxBounceCount = 16, RussianRouletteBounceCount = 16 }, CancellationToken.None);
+        otherRenderer.Render(otherImage, scene, camera, new RenderOptions { RenderMode = renderMode, MaxBounceCount = 16, RussianRouletteBounceCount = 2 }, CancellationToken.None);
+
+        // Assert
+        var result = _sut.Counters.GetValues();
+        var otherResult = otherRenderer.Counters.GetValues();
+
+        Assert.Equal(0, result.RussianRouletteCount);
+        Assert.True(otherResult.RussianRouletteCount > 0);
+        Assert.True(otherResult.BouncesPerPath < result.BouncesPerPath * 0.5);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldKeepAverageColor_WhenRussianRouletteIsEnabled(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        var scene = CreateSphereGridScene();
+        var camera = _camera with { Position = new Vector3(0.5f) };
+        var otherAccumulationBuffer = new AccumulationBuffer(100, 100);
+        var otherImage = Substitute.For<IImage>();
+        otherImage.Width.Returns(100);
+        otherImage.Height.Returns(100);
+        otherImage.AccumulationBuffer.Returns(otherAccumulationBuffer);
+
+        // Act
+        _sut.Render(_mockImage, scene, camera, new RenderOptions { RenderMode = renderMode, MaxBounceCount = 16, RussianRouletteBounceCount = 16 }, CancellationToken.None);
+        _sut.Render(otherImage, scene, camera, new RenderOptions { RenderMode = renderMode, MaxBounceCount = 16, RussianRouletteBounceCount = 2 }, CancellationToken.None);
+
+        // Assert
+        var expectedImage = new Vector4[100 * 100];
+        var resultImage = new Vector4[100 * 100];
+        _accumulationBuffer.Resolve(expectedImage);
+        otherAccumulationBuffer.Resolve(resultImage);
+
+        var expectedAverage = expectedImage.Average(pixel => pixel.X);
+        var resultAverage = resultImage.Average(pixel => pixel.X);
+
+        Assert.Equal(expectedAverage, resultAverage, expectedAverage * 0.02f);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldLightSmoothDielectric_WhenSceneHasPointLight(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        _scene.Materials.Add(new Material { Albedo = Vector3.One, Roughness = 0.0f, Metallic = 0.0f });
+        _scene.Spheres.Add(new Sphere { Position = Vector3.Zero, Radius = 1.0f, MaterialIndex = 0 });
+
+        var litScene = new Scene(_scene.Spheres, _scene.Materials);
+        litScene.Lights.Add(new Light { Type = LightType.Point, Position = new Vector3(0.0f, 2.0f, -4.0f), Intensity = 20.0f });
+
+        var camera = _camera with { Position = new Vector3(0.0f, 0.0f, -4.0f) };
+        var otherAccumulationBuffer = new AccumulationBuffer(100, 100);
+        var otherImage = Substitute.For<IImage>();
+        otherImage.Width.Returns(100);
+        otherImage.Height.Returns(100);
+        otherImage.AccumulationBuffer.Returns(otherAccumulationBuffer);
+
+        // Act
+        _sut.Render(_mockImage, _scene, camera, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
+        _sut.Render(otherImage, litScene, camera, new RenderOptions { RenderMode = renderMode }, CancellationToken.None);
+
+        // Assert
+        var unlitImage = new Vector4[100 * 100];
+        var litImage = new Vector4[100 * 100];
+        _accumulationBuffer.Resolve(unlitImage);
+        otherAccumulationBuffer.Resolve(litImage);
+
+        Assert.True(litImage.Average(pixel => pixel.X) > unlitImage.Average(pixel => pixel.X) * 1.05f);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldStopSampling_WhenImageIsConverged(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        var renderOptions = new RenderOptions { RenderMode = renderMode, AdaptiveErrorThreshold = 0.01f };
+
+        // Act
+        for (var i = 0; i < AccumulationBuffer.MinimumConvergenceSampleCount + 2; i++)
+        {
+            _sut.Render(_mockImage, _scene, _camera, renderOptions, CancellationToken.None);
+        }
+
+        // Assert
+        Assert.True(_accumulationBuffer.IsConverged);
+        Assert.Equal(100 * 100 * AccumulationBuffer.MinimumConvergenceSampleCount, _sut.Counters.SampleCount);
+    }
+
+    [Theory]
+    [InlineData(RenderMode.PerPixel)]
+    [InlineData(RenderMode.Wavefront)]
+    public void Render_ShouldMatchWholeImage_WhenImageIsRenderedInBands(RenderMode renderMode)
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        var scene = new Scene();
+        scene.Materials.Add(new Material { Albedo = new Vector3(1.0f, 0.5f, 0.2f), Roughness = 0.5f });
+        scene.Spheres.Add(new Sphere { Position = Vector3.Zero, Radius = 1.0f, MaterialIndex = 0 });
+
+        var camera = new Camera { Position = new Vector3(0.0f, 0.0f, -4.0f) };
+        var renderOptions = new RenderOptions { RenderMode = renderMode, TileSize = 16 };
+
+        _sut.Render(_mockImage, scene, camera, renderOptions, CancellationToken.None);
+
+        var bandAccumulationBuffer = new AccumulationBuffer(100, 30);
+        var bandImage = Substitute.For<IImage>();
+        bandImage.Width.Returns(100);
+        bandImage.Height.Returns(100);
+        bandImage.AccumulationBuffer.Returns(bandAccumulationBuffer);
+
+        var expectedRow = new Vector4[100];
+        var resultRow = new Vector4[100];
+
+        for (var bandY = 0; bandY < 90; bandY += 30)
+        {
+            // Act
+            bandAccumulationBuffer.Reset();
+            _sut.Render(bandImage, scene, camera, renderOptions with { Region = new Tile { X = 0, Y = bandY, Width = 100, Height = 30 } }, CancellationToken.None);
+
+            // Assert
+            for (var i = 0; i < 30; i++)
+            {
+                _accumulationBuffer.ResolveRow(bandY + i, expectedRow);
+                bandAccumulationBuffer.ResolveRow(i, resultRow);
+
+                Assert.Equal(expectedRow, resultRow);
+            }
+        }
+    }
+
+    [Fact]
+    public void Render_ShouldThrowArgumentException_WhenRegionIsOutsideImage()
+    {
+        // Arrange
+        _mockImage.Width.Returns(100);
+        _mockImage.Height.Returns(100);
+
+        // Act
+        var action = () => { _sut.Render(_mockImage, _scene, _camera, new RenderOptions { Region = new Tile { X = 0, Y = 50, Width = 100, Height = 100 } }, CancellationToken.None); };
+
+        // Assert
+        Assert.Throws<ArgumentOutOfRangeException>(action);
+    }
+
+    [Fact]
+    public void Render_ShouldThrowArgumentException_WhenAccumulationBufferSizeIsDifferent()
+    {
+        // Arrange
+        _mockImage.Width.Returns(200);
+        _mockImage.Height.Returns(100);
+
+        // Act
+        var action = () => { _sut.Render(_mockImage, _scene, _camera, new RenderOptions(), CancellationToken.None); };
+
+        // Assert
+        Assert.Throws<ArgumentOutOfRangeException>(action);
+    }
+
+    // NOTE: Grid of emissive diffuse spheres around the camera, most paths bounce many times
+    // before they escape and every hit adds some light
+    private static Scene CreateSphereGridScene()
+    {
+        var scene = new Scene();
+        scene.Materials.Add(new Material { Albedo = new Vector3(0.5f), Roughness = 1.0f, Emission = new Vector3(0.1f) });
+
+        for (var x = -4; x <= 4; x++)
+        {
+            for (var y = -4; y <= 4; y++)
+            {
+                for (var z = -4; z <= 4; z++)
+                {
+                    scene.Spheres.Add(new Sphere { Position = new Vector3(x, y, z), Radius = 0.45f, MaterialIndex = 0 });
+                }
+            }
+        }
+
+        return scene;
+    }
+}
@@ -0,0 +1,282 @@
+namespace PathTracer.Core.UnitTests;
+
+public sealed class SceneFileTests : IDisposable
+{
+    private readonly string _filePath;
+
+    public SceneFileTests()
+    {
+        _filePath = Path.Combine(Path.GetTempPath(), $"{Guid.NewGuid()}{SceneFile.Extension}");
+    }
+
+    public void Dispose()
+    {
+        File.Delete(_filePath);
+    }
+
+    [Fact]
+    public void Read_ShouldReturnSameScene_WhenSceneWasWritten()
+    {
+        // Arrange
+        var scene = CreateRandomScene(100);
+        var camera = new Camera { Position = new Vector3(1.0f, 2.0f, 3.0f), VerticalFov = 60.0f, AspectRatio = 2.0f };
+
+        SceneFile.Write(_filePath, scene, camera, null);
+
+        // Act
+        var result = SceneFile.Read(_filePath, out var resultCamera);
+
+        // Assert
+        Assert.Equal(scene.Spheres, result.Spheres);
+        Assert.Equal(scene.Materials, result.Materials);
+        Assert.Equal(camera, resultCamera);
+        Assert.Null(result.AccelerationStructure);
+    }
+
+    [Fact]
+    public void Read_ShouldLoadPrebuiltHierarchy_WhenAccelerationStructureWasWritten()
+    {
+        // Arrange
+        var scene = CreateRandomScene(1000);
+        var accelerationStructure = BoundingVolumeHierarchy.Build(scene.Spheres);
+
+        SceneFile.Write(_filePath, scene, new Camera(), accelerationStructure);
+
+        // Act
+        var result = SceneFile.Read(_filePath, out _);
+
+        // Assert
+        var resultAccelerationStructure = result.AccelerationStructure;
+
+        Assert.NotNull(resultAccelerationStructure);
+        Assert.Equal(accelerationStructure.Nodes.ToArray(), resultAccelerationStructure!.Nodes.ToArray());
+        Assert.Equal(accelerationStructure.PrimitiveIndices.ToArray(), resultAccelerationStructure.PrimitiveIndices.ToArray());
+
+        var random = new Random(42);
+
+        for (var i = 0; i < 100; i++)
+        {
+            var ray = new Ray
+            {
+                Origin = new Vector3(random.NextSingle() * 30.0f - 15.0f, random.NextSingle() * 30.0f - 15.0f, -20.0f),
+                Direction = Vector3.UnitZ
+            };
+
+            var expectedHit = accelerationStructure.Intersect(ray, out var expectedDistance, out var expectedIndex);
+            var hit = resultAccelerationStructure.Intersect(ray, out var distance, out var objectIndex);
+
+            Assert.Equal(expectedHit, hit);
+            Assert.Equal(expectedDistance, distance);
+            Assert.Equal(expectedIndex, objectIndex);
+        }
+    }
+
+    [Fact]
+    public void Read_ShouldReturnSameScene_WhenSceneWasWrittenToMemory()
+    {
+        // Arrange
+        var scene = CreateRandomScene(100);
+        var camera = new Camera { Position = new Vector3(1.0f, 2.0f, 3.0f) };
+        var accelerationStructure = BoundingVolumeHierarchy.Build(scene.Spheres);
+
+        using var stream = new MemoryStream();
+        SceneFile.Write(stream, scene, camera, accelerationStructure);
+
+        // Act
+        var result = SceneFile.Read(stream.ToArray(), out var resultCamera);
+
+        // Assert
+        Assert.Equal(scene.Spheres, result.Spheres);
+        Assert.Equal(scene.Materials, result.Materials);
+        Assert.Equal(camera, resultCamera);
+        Assert.Equal(accelerationStructure.Nodes.ToArray(), result.AccelerationStructure!.Nodes.ToArray());
+    }
+
+    [Fact]
+    public void Read_ShouldReturnSameInstances_WhenSceneHasGeometries()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+        scene.Geometries.Add(new GeometryBlock([new Sphere { Radius = 2.0f, MaterialIndex = 1 }]));
+        scene.Geometries.Add(new GeometryBlock([new Sphere(), new Sphere { Position = Vector3.UnitY }]));
+        scene.Instances.Add(new Instance { GeometryIndex = 1, Position = Vector3.UnitX, Scale = 2.0f, MaterialIndex = 0 });
+        scene.Instances.Add(new Instance { GeometryIndex = 0, Rotation = Quaternion.CreateFromYawPitchRoll(1.0f, 0.0f, 0.0f) });
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var result = SceneFile.Read(_filePath, out _);
+
+        // Assert
+        Assert.Equal(scene.Geometries.Count, result.Geometries.Count);
+
+        for (var i = 0; i < scene.Geometries.Count; i++)
+        {
+            Assert.Equal(scene.Geometries[i].Spheres, result.Geometries[i].Spheres);
+        }
+
+        Assert.Equal(scene.Instances, result.Instances);
+    }
+
+    [Fact]
+    public void Read_ShouldReturnSameLights_WhenSceneHasLights()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+
+        scene.Materials.Add(new Material { Emission = new Vector3(4.0f, 3.0f, 2.0f) });
+        scene.Lights.Add(new Light { Direction = new Vector3(1.0f, -1.0f, 0.0f), Intensity = 2.0f });
+        scene.Lights.Add(new Light { Type = LightType.Point, Position = new Vector3(0.0f, 5.0f, 0.0f), Color = new Vector3(1.0f, 0.5f, 0.2f), Intensity = 10.0f, Radius = 0.5f });
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var result = SceneFile.Read(_filePath, out _);
+
+        // Assert
+        Assert.Equal(scene.Materials, result.Materials);
+        Assert.Equal(scene.Lights, result.Lights);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenVersionIsDifferent()
+    {
+        // Arrange
+        SceneFile.Write(_filePath, CreateRandomScene(10), new Camera(), null);
+
+        var data = File.ReadAllBytes(_filePath);
+        data[4] = 99;
+        File.WriteAllBytes(_filePath, data);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenFileIsTruncated()
+    {
+        // Arrange
+        var scene = CreateRandomScene(100);
+        SceneFile.Write(_filePath, scene, new Camera(), BoundingVolumeHierarchy.Build(scene.Spheres));
+
+        var data = File.ReadAllBytes(_filePath);
+        File.WriteAllBytes(_filePath, data.AsSpan(0, data.Length - 4).ToArray());
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Theory]
+    [InlineData(8)]
+    [InlineData(24)]
+    [InlineData(32)]
+    public void Read_ShouldThrowInvalidDataException_WhenHeaderValueIsCorrupted(int headerOffset)
+    {
+        // Arrange
+        var scene = CreateRandomScene(100);
+        SceneFile.Write(_filePath, scene, new Camera(), BoundingVolumeHierarchy.Build(scene.Spheres));
+
+        var data = File.ReadAllBytes(_filePath);
+        BitConverter.TryWriteBytes(data.AsSpan(headerOffset), int.MaxValue);
+        File.WriteAllBytes(_filePath, data);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenSphereMaterialIndexIsOutOfRange()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+        scene.Spheres[5] = scene.Spheres[5] with { MaterialIndex = scene.Materials.Count };
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenGeometrySphereMaterialIndexIsOutOfRange()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+        scene.Geometries.Add(new GeometryBlock([new Sphere { MaterialIndex = -1 }]));
+        scene.Instances.Add(new Instance());
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenInstanceMaterialIndexIsOutOfRange()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+        scene.Geometries.Add(new GeometryBlock([new Sphere()]));
+        scene.Instances.Add(new Instance { MaterialIndex = scene.Materials.Count });
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    [Fact]
+    public void Read_ShouldThrowInvalidDataException_WhenLightTypeIsUnknown()
+    {
+        // Arrange
+        var scene = CreateRandomScene(10);
+        scene.Lights.Add(new Light { Type = (LightType)99 });
+
+        SceneFile.Write(_filePath, scene, new Camera(), null);
+
+        // Act
+        var action = () => { SceneFile.Read(_filePath, out _); };
+
+        // Assert
+        Assert.Throws<InvalidDataException>(action);
+    }
+
+    private static Scene CreateRandomScene(int sphereCount)
+    {
+        var random = new Random(sphereCount);
+        var scene = new Scene();
+
+        scene.Materials.Add(new Material { Albedo = new Vector3(1.0f, 0.0f, 0.0f), Roughness = 0.2f });
+        scene.Materials.Add(new Material { Albedo = new Vector3(0.0f, 1.0f, 0.0f), Roughness = 0.8f, Metallic = 1.0f });
+
+        for (var i = 0; i < sphereCount; i++)
+        {
+            scene.Spheres.Add(new Sphere
+            {
+                Position = new Vector3(random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f, random.NextSingle() * 20.0f - 10.0f),
+                Radius = random.NextSingle() * 0.5f + 0.01f,
+                MaterialIndex = i % 2
+            });
+        }
+
+        return scene;
+    }
+}
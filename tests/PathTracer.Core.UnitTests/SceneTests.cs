@@ -0,0 +1,243 @@
+namespace PathTracer.Core.UnitTests;
+
+public class SceneTests
+{
+    [Fact]
+    public void CommitChanges_ShouldBuildAccelerationStructure_WhenSceneHasNone()
+    {
+        // Arrange
+        var sut = CreateScene();
+
+        // Act
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.True(result.IsAccelerationStructureRebuilt);
+        Assert.NotNull(sut.AccelerationStructure);
+        Assert.Equal(sut.Spheres.Count, sut.AccelerationStructure.PrimitiveIndices.Length);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldNotReportChanges_WhenSceneWasNotEdited()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.CommitChanges();
+
+        // Act
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.False(result.HasChanges);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldRefitAccelerationStructure_WhenSphereWasMoved()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.CommitChanges();
+
+        var accelerationStructure = sut.AccelerationStructure;
+        var version = sut.Version;
+
+        // Act
+        sut.UpdateSphere(3, sut.Spheres[3] with { Position = new Vector3(100.0f, 0.0f, 0.0f) });
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.True(result.HasChanges);
+        Assert.Equal(1, result.MovedSphereCount);
+        Assert.False(result.IsAccelerationStructureRebuilt);
+        Assert.Same(accelerationStructure, sut.AccelerationStructure);
+        Assert.NotEqual(version, sut.Version);
+        Assert.True(sut.AccelerationStructure!.Intersect(new Ray { Origin = new Vector3(100.0f, 0.0f, -10.0f), Direction = Vector3.UnitZ }, out _, out var objectIndex));
+        Assert.Equal(3, objectIndex);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldKeepGeometry_WhenOnlyMaterialsChanged()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.CommitChanges();
+
+        var nodes = sut.AccelerationStructure!.Nodes.ToArray();
+
+        // Act
+        sut.UpdateMaterial(0, new Material { Albedo = Vector3.UnitX });
+        sut.UpdateSphere(1, sut.Spheres[1] with { MaterialIndex = 1 });
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.True(result.HasChanges);
+        Assert.Equal(1, result.ChangedMaterialCount);
+        Assert.Equal(1, result.ChangedSphereCount);
+        Assert.Equal(0, result.MovedSphereCount);
+        Assert.False(result.IsAccelerationStructureRebuilt);
+        Assert.Equal(nodes, sut.AccelerationStructure.Nodes.ToArray());
+    }
+
+    [Fact]
+    public void UpdateSphere_ShouldNotChangeVersion_WhenSphereIsTheSame()
+    {
+        // Arrange
+        var sut = CreateScene();
+        var version = sut.Version;
+
+        // Act
+        sut.UpdateSphere(0, sut.Spheres[0]);
+
+        // Assert
+        Assert.Equal(version, sut.Version);
+        Assert.Empty(sut.ChangedSphereIndices);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldReturnChanges_WhenLightWasUpdated()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.Lights.Add(new Light { Direction = -Vector3.UnitY, Intensity = 1.0f });
+        sut.CommitChanges();
+
+        sut.UpdateLight(0, sut.Lights[0] with { Intensity = 2.0f });
+
+        // Act
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.True(result.HasChanges);
+        Assert.Equal(1, result.ChangedLightCount);
+        Assert.False(result.IsAccelerationStructureRebuilt);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldBuildInstanceAccelerationStructure_WhenSceneHasInstances()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.Geometries.Add(new GeometryBlock([new Sphere(), new Sphere { Position = Vector3.UnitX }]));
+        sut.Instances.Add(new Instance { Position = new Vector3(0.0f, 0.0f, 10.0f) });
+
+        // Act
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.True(result.IsAccelerationStructureRebuilt);
+        Assert.NotNull(sut.Geometries[0].AccelerationStructure);
+        Assert.NotNull(sut.InstanceAccelerationStructure);
+        Assert.Equal(1, sut.InstanceAccelerationStructure.InstanceCount);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldKeepGeometryHierarchies_WhenInstanceWasMoved()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.Geometries.Add(new GeometryBlock([new Sphere()]));
+        sut.Instances.Add(new Instance());
+        sut.CommitChanges();
+
+        var geometryHierarchy = sut.Geometries[0].AccelerationStructure;
+        var accelerationStructure = sut.AccelerationStructure;
+        var instanceAccelerationStructure = sut.InstanceAccelerationStructure;
+
+        sut.UpdateInstance(0, sut.Instances[0] with { Position = new Vector3(5.0f, 0.0f, 0.0f) });
+
+        // Act
+        var result = sut.CommitChanges();
+
+        // Assert
+        Assert.Equal(1, result.ChangedInstanceCount);
+        Assert.True(result.HasChanges);
+        Assert.Same(geometryHierarchy, sut.Geometries[0].AccelerationStructure);
+        Assert.Same(accelerationStructure, sut.AccelerationStructure);
+        Assert.NotSame(instanceAccelerationStructure, sut.InstanceAccelerationStructure);
+    }
+
+    [Fact]
+    public void CommitChanges_ShouldRebuildBlockHierarchy_WhenGeometrySphereWasMoved()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.Geometries.Add(new GeometryBlock([new Sphere { Radius = 1.0f }]));
+        sut.Instances.Add(new Instance { Position = new Vector3(0.0f, 0.0f, 10.0f) });
+        sut.CommitChanges();
+
+        var snapshot = sut.CreateSnapshot();
+        var ray = new Ray { Origin = new Vector3(5.0f, 0.0f, -10.0f), Direction = Vector3.UnitZ };
+
+        // Act
+        sut.UpdateGeometrySphere(0, 0, new Sphere { Position = new Vector3(5.0f, 0.0f, 0.0f), Radius = 1.0f });
+        var result = sut.CommitChanges();
+
+        // Assert
+        var hitDistance = float.MaxValue;
+        var instanceIndex = -1;
+        var objectIndex = -1;
+        var intersectionTestCount = 0L;
+
+        Assert.Equal(1, result.ChangedGeometryCount);
+        Assert.True(result.HasChanges);
+        Assert.True(sut.InstanceAccelerationStructure!.IntersectClosest(ray, ref hitDistance, ref instanceIndex, ref objectIndex, ref intersectionTestCount));
+        Assert.Equal(Vector3.Zero, snapshot.Geometries[0].Spheres[0].Position);
+    }
+
+    [Fact]
+    public void CreateSnapshot_ShouldKeepGeometry_WhenSceneIsEditedAfterSnapshot()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.CommitChanges();
+
+        var snapshot = sut.CreateSnapshot();
+        var ray = new Ray { Origin = new Vector3(9.0f, 0.0f, -10.0f), Direction = Vector3.UnitZ };
+
+        // Act
+        sut.UpdateSphere(3, sut.Spheres[3] with { Position = new Vector3(100.0f, 0.0f, 0.0f) });
+        sut.CommitChanges();
+
+        // Assert
+        Assert.Equal(new Vector3(9.0f, 0.0f, 0.0f), snapshot.Spheres[3].Position);
+        Assert.NotSame(sut.AccelerationStructure, snapshot.AccelerationStructure);
+        Assert.True(snapshot.AccelerationStructure!.Intersect(ray, out _, out var objectIndex));
+        Assert.Equal(3, objectIndex);
+        Assert.False(sut.AccelerationStructure!.Intersect(ray, out _, out _));
+    }
+
+    [Fact]
+    public void CreateSnapshot_ShouldOnlyCopyEditedList_WhenMaterialIsEditedAfterSnapshot()
+    {
+        // Arrange
+        var sut = CreateScene();
+        sut.CommitChanges();
+
+        var snapshot = sut.CreateSnapshot();
+
+        // Act
+        sut.UpdateMaterial(0, new Material { Albedo = Vector3.UnitX });
+        sut.CommitChanges();
+
+        // Assert
+        Assert.NotEqual(Vector3.UnitX, snapshot.Materials[0].Albedo);
+        Assert.NotSame(sut.Materials, snapshot.Materials);
+        Assert.Same(sut.Spheres, snapshot.Spheres);
+        Assert.Same(sut.AccelerationStructure, snapshot.AccelerationStructure);
+    }
+
+    private static Scene CreateScene()
+    {
+        var scene = new Scene();
+
+        scene.Materials.Add(new Material());
+        scene.Materials.Add(new Material());
+
+        for (var i = 0; i < 100; i++)
+        {
+            scene.Spheres.Add(new Sphere { Position = new Vector3(i % 10, i / 10, 0.0f) * 3.0f, Radius = 1.0f });
+        }
+
+        return scene;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+namespace PathTracer.Core.UnitTests;
+
+public class TileSchedulerTests
+{
+    [Theory]
+    [InlineData(TileOrder.Scanline)]
+    [InlineData(TileOrder.Morton)]
+    [InlineData(TileOrder.Spiral)]
+    public void CreateTiles_ShouldCoverEveryPixelOnce_WhenImageSizeIsNotMultipleOfTileSize(TileOrder tileOrder)
+    {
+        // Arrange
+        const int width = 100;
+        const int height = 70;
+
+        // Act
+        var result = TileScheduler.CreateTiles(width, height, 16, tileOrder);
+
+        // Assert
+        var coveredPixels = new int[width * height];
+
+        foreach (var tile in result)
+        {
+            for (var i = tile.Y; i < tile.Y + tile.Height; i++)
+            {
+                for (var j = tile.X; j < tile.X + tile.Width; j++)
+                {
+                    coveredPixels[i * width + j]++;
+                }
+            }
+        }
+
+        Assert.Equal(7 * 5, result.Length);
+        Assert.All(coveredPixels, count => Assert.Equal(1, count));
+    }
+
+    [Fact]
+    public void CreateTiles_ShouldOrderTilesAlongZCurve_WhenOrderIsMorton()
+    {
+        // Act
+        var result = TileScheduler.CreateTiles(64, 64, 16, TileOrder.Morton);
+
+        // Assert
+        Assert.Equal(new Tile { X = 0, Y = 0, Width = 16, Height = 16 }, result[0]);
+        Assert.Equal(new Tile { X = 16, Y = 0, Width = 16, Height = 16 }, result[1]);
+        Assert.Equal(new Tile { X = 0, Y = 16, Width = 16, Height = 16 }, result[2]);
+        Assert.Equal(new Tile { X = 16, Y = 16, Width = 16, Height = 16 }, result[3]);
+        Assert.Equal(new Tile { X = 32, Y = 0, Width = 16, Height = 16 }, result[4]);
+    }
+
+    [Fact]
+    public void CreateTiles_ShouldStartWithCenterTile_WhenOrderIsSpiral()
+    {
+        // Act
+        var result = TileScheduler.CreateTiles(80, 80, 16, TileOrder.Spiral);
+
+        // Assert
+        Assert.Equal(new Tile { X = 32, Y = 32, Width = 16, Height = 16 }, result[0]);
+        Assert.All(result.AsSpan(1, 8).ToArray(), tile => Assert.InRange(tile.X, 16, 48));
+    }
+
+    [Fact]
+    public void CreateTiles_ShouldThrowArgumentException_WhenTileSizeIsZero()
+    {
+        // Act
+        var action = () => { TileScheduler.CreateTiles(100, 100, 0, TileOrder.Morton); };
+
+        // Assert
+        Assert.Throws<ArgumentOutOfRangeException>(action);
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(3)]
+    [InlineData(64)]
+    public void Run_ShouldRenderEveryTileOnce_WhenWorkersStealWork(int workerCount)
+    {
+        // Arrange
+        var tiles = TileScheduler.CreateTiles(256, 256, 8, TileOrder.Morton);
+        var renderCounts = new int[256 * 256];
+        var workerStateCount = 0;
+
+        // Act
+        TileScheduler.Run(tiles, workerCount, () => Interlocked.Increment(ref workerStateCount), (tile, _) =>
+        {
+            // Make the workload uneven so the workers have to steal tiles
+            if (tile.X < 64)
+            {
+                Thread.SpinWait(1000);
+            }
+
+            Interlocked.Increment(ref renderCounts[tile.Y * 256 + tile.X]);
+        },
+        CancellationToken.None);
+
+        // Assert
+        foreach (var tile in tiles)
+        {
+            Assert.Equal(1, renderCounts[tile.Y * 256 + tile.X]);
+        }
+
+        Assert.Equal(tiles.Length, renderCounts.Sum());
+        Assert.InRange(workerStateCount, 1, workerCount);
+    }
+
+    [Fact]
+    public void Run_ShouldStopAfterCurrentTiles_WhenCancellationIsRequested()
+    {
+        // Arrange
+        var tiles = TileScheduler.CreateTiles(256, 256, 8, TileOrder.Morton);
+        using var cancellationTokenSource = new CancellationTokenSource();
+        var renderCount = 0;
+
+        // Act
+        var action = () =>
+        {
+            TileScheduler.Run(tiles, 4, () => 0, (tile, _) =>
+            {
+                if (Interlocked.Increment(ref renderCount) == 10)
+                {
+                    cancellationTokenSource.Cancel();
+                }
+            },
+            cancellationTokenSource.Token);
+        };
+
+        // Assert
+        Assert.ThrowsAny<OperationCanceledException>(action);
+        Assert.InRange(renderCount, 10, 10 + 4);
+    }
+}
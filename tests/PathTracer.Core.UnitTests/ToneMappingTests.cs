@@ -0,0 +1,140 @@
+namespace PathTracer.Core.UnitTests;
+
+public class ToneMappingTests
+{
+    [Fact]
+    public void ResolveToRgba8_ShouldMatchGammaCorrection_WhenOperatorIsClamp()
+    {
+        // Arrange
+        var source = new Vector4[1024];
+
+        for (var i = 0; i < source.Length; i++)
+        {
+            var value = (float)i / (source.Length - 1);
+            source[i] = new Vector4(value, value * 0.5f, value * value, 1.0f);
+        }
+
+        var result = new uint[source.Length];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source, 1.0f, result, ToneMappingOperator.Clamp);
+
+        // Assert
+        for (var i = 0; i < source.Length; i++)
+        {
+            Assert.InRange((int)(result[i] & 0xFF), ToGammaByte(source[i].X) - 1, ToGammaByte(source[i].X) + 1);
+            Assert.InRange((int)((result[i] >> 8) & 0xFF), ToGammaByte(source[i].Y) - 1, ToGammaByte(source[i].Y) + 1);
+            Assert.InRange((int)((result[i] >> 16) & 0xFF), ToGammaByte(source[i].Z) - 1, ToGammaByte(source[i].Z) + 1);
+            Assert.Equal(255u, result[i] >> 24);
+        }
+    }
+
+    [Theory]
+    [InlineData(ToneMappingOperator.Clamp)]
+    [InlineData(ToneMappingOperator.Reinhard)]
+    [InlineData(ToneMappingOperator.Aces)]
+    public void ResolveToRgba8_ShouldWriteBlackPixel_WhenSampleIsZero(ToneMappingOperator toneMappingOperator)
+    {
+        // Arrange
+        var source = new Vector4[] { new Vector4(0.0f, 0.0f, 0.0f, 1.0f) };
+        var result = new uint[1];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source, 1.0f, result, toneMappingOperator);
+
+        // Assert
+        Assert.Equal(0xFF000000u, result[0]);
+    }
+
+    [Fact]
+    public void ResolveToRgba8_ShouldScaleSamples_WhenFramesAreAccumulated()
+    {
+        // Arrange
+        var source = new Vector4[] { new Vector4(4.0f, 8.0f, 2.0f, 4.0f) };
+        var result = new uint[1];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source, 0.25f, result, ToneMappingOperator.Clamp);
+
+        // Assert
+        Assert.Equal(0xFFBAFFFFu, result[0]);
+    }
+
+    [Fact]
+    public void ResolveToRgba8_ShouldCompressHighlights_WhenOperatorIsReinhard()
+    {
+        // Arrange
+        var source = new Vector4[] { new Vector4(1.0f, 3.0f, 100.0f, 1.0f) };
+        var result = new uint[1];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source, 1.0f, result, ToneMappingOperator.Reinhard);
+
+        // Assert
+        Assert.InRange((int)(result[0] & 0xFF), ToGammaByte(0.5f) - 1, ToGammaByte(0.5f) + 1);
+        Assert.InRange((int)((result[0] >> 8) & 0xFF), ToGammaByte(0.75f) - 1, ToGammaByte(0.75f) + 1);
+        Assert.InRange((int)((result[0] >> 16) & 0xFF), 250, 255);
+    }
+
+    [Fact]
+    public void ResolveToRgba8_ShouldSaturateHighlights_WhenOperatorIsAces()
+    {
+        // Arrange
+        var source = new Vector4[] { new Vector4(0.18f, 1.0f, 100.0f, 1.0f) };
+        var result = new uint[1];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source, 1.0f, result, ToneMappingOperator.Aces);
+
+        // Assert
+        Assert.InRange((int)(result[0] & 0xFF), ToGammaByte(0.2669f) - 1, ToGammaByte(0.2669f) + 1);
+        Assert.InRange((int)((result[0] >> 8) & 0xFF), ToGammaByte(0.8038f) - 1, ToGammaByte(0.8038f) + 1);
+        Assert.Equal(255u, (result[0] >> 16) & 0xFF);
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(7)]
+    [InlineData(37)]
+    public void ResolveToRgba8_ShouldMatchBlockResult_WhenPixelCountIsNotMultipleOfBlockSize(int pixelCount)
+    {
+        // Arrange
+        var random = new Random(42);
+        var source = new Vector4[pixelCount + ToneMapping.BlockPixelCount * 4];
+
+        for (var i = 0; i < source.Length; i++)
+        {
+            source[i] = new Vector4(random.NextSingle(), random.NextSingle(), random.NextSingle(), 1.0f);
+        }
+
+        var expected = new uint[source.Length];
+        ToneMapping.ResolveToRgba8(source, 1.0f, expected, ToneMappingOperator.Clamp);
+
+        var result = new uint[pixelCount];
+
+        // Act
+        ToneMapping.ResolveToRgba8(source.AsSpan(0, pixelCount), 1.0f, result, ToneMappingOperator.Clamp);
+
+        // Assert
+        Assert.Equal(expected.AsSpan(0, pixelCount).ToArray(), result);
+    }
+
+    [Fact]
+    public void ResolveToRgba8_ShouldThrowArgumentException_WhenDestinationIsTooSmall()
+    {
+        // Arrange
+        var source = new Vector4[16];
+        var result = new uint[15];
+
+        // Act
+        var action = () => { ToneMapping.ResolveToRgba8(source, 1.0f, result, ToneMappingOperator.Clamp); };
+
+        // Assert
+        Assert.Throws<ArgumentOutOfRangeException>(action);
+    }
+
+    private static int ToGammaByte(float value)
+    {
+        return (int)(MathF.Pow(Math.Clamp(value, 0.0f, 1.0f), 1.0f / 2.2f) * 255.0f + 0.5f);
+    }
+}
@@ -0,0 +1,79 @@
+namespace PathTracer.IntegrationTests;
+
+public class PreviewResolutionControllerTests
+{
+    private readonly PreviewResolutionController _sut;
+
+    public PreviewResolutionControllerTests()
+    {
+        _sut = new PreviewResolutionController(TimeSpan.FromMilliseconds(30));
+        _sut.SetResolution(1600, 800);
+    }
+
+    [Fact]
+    public void GetMotionFrame_ShouldReturnSmallestLevel_WhenNothingWasMeasured()
+    {
+        // Act
+        var (level, sampleCount) = _sut.GetMotionFrame();
+
+        // Assert
+        Assert.Equal(0, level);
+        Assert.Equal(1, sampleCount);
+        Assert.Equal((200, 100), _sut.GetLevelSize(level));
+    }
+
+    [Fact]
+    public void GetMotionFrame_ShouldReturnLargestLevelInBudget_WhenRenderWasMeasured()
+    {
+        // Arrange
+        // 400x200 pixels render in 16ms, 800x400 would take 64ms
+        _sut.AddMeasurement(400 * 200, TimeSpan.FromMilliseconds(16));
+
+        // Act
+        var (level, sampleCount) = _sut.GetMotionFrame();
+
+        // Assert
+        Assert.Equal(1, level);
+        Assert.Equal(1, sampleCount);
+    }
+
+    [Fact]
+    public void GetMotionFrame_ShouldAddSamples_WhenLargestLevelIsFast()
+    {
+        // Arrange
+        _sut.AddMeasurement(800 * 400, TimeSpan.FromMilliseconds(9));
+
+        // Act
+        var (level, sampleCount) = _sut.GetMotionFrame();
+
+        // Assert
+        Assert.Equal(_sut.LevelCount - 1, level);
+        Assert.Equal(3, sampleCount);
+    }
+
+    [Fact]
+    public void GetIdleLevel_ShouldReturnNextLevel_WhenNextLevelFitsInFrame()
+    {
+        // Arrange
+        _sut.AddMeasurement(400 * 200, TimeSpan.FromMilliseconds(16));
+
+        // Act
+        var result = _sut.GetIdleLevel(0);
+
+        // Assert
+        Assert.Equal(1, result);
+    }
+
+    [Fact]
+    public void GetIdleLevel_ShouldStartFullResolution_WhenNextLevelDoesNotFitInFrame()
+    {
+        // Arrange
+        _sut.AddMeasurement(400 * 200, TimeSpan.FromMilliseconds(16));
+
+        // Act
+        var result = _sut.GetIdleLevel(1);
+
+        // Assert
+        Assert.Equal(_sut.LevelCount, result);
+    }
+}
\ No newline at end of file
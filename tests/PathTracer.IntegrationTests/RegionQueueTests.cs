@@ -0,0 +1,128 @@
+using PathTracer.Console;
+
+namespace PathTracer.IntegrationTests;
+
+public class RegionQueueTests
+{
+    [Fact]
+    public void TryTake_ShouldReturnEveryRegion_WhenRegionsArePending()
+    {
+        // Arrange
+        var sut = new RegionQueue(3);
+
+        // Act
+        sut.TryTake(out var regionIndex1);
+        sut.TryTake(out var regionIndex2);
+        sut.TryTake(out var regionIndex3);
+
+        // Assert
+        Assert.Equal([0, 1, 2], new[] { regionIndex1, regionIndex2, regionIndex3 });
+    }
+
+    [Fact]
+    public void TryTake_ShouldReturnBackupCopy_WhenEveryRegionIsInFlight()
+    {
+        // Arrange
+        var sut = new RegionQueue(2);
+        sut.TryTake(out _);
+        sut.TryTake(out var regionIndex);
+        sut.Complete(0);
+
+        // Act
+        var result = sut.TryTake(out var backupRegionIndex);
+
+        // Assert
+        Assert.True(result);
+        Assert.Equal(regionIndex, backupRegionIndex);
+    }
+
+    [Fact]
+    public void TryTake_ShouldReturnReleasedRegion_WhenWorkerWasLost()
+    {
+        // Arrange
+        var sut = new RegionQueue(2);
+        sut.TryTake(out var regionIndex);
+        sut.TryTake(out _);
+        sut.Complete(1);
+        sut.Release(regionIndex);
+
+        // Act
+        var result = sut.TryTake(out var releasedRegionIndex);
+
+        // Assert
+        Assert.True(result);
+        Assert.Equal(regionIndex, releasedRegionIndex);
+    }
+
+    [Fact]
+    public void Release_ShouldNotRequeueRegion_WhenBackupCopyIsStillInFlight()
+    {
+        // Arrange
+        var sut = new RegionQueue(1);
+        sut.TryTake(out var regionIndex);
+        sut.TryTake(out _);
+        sut.Release(regionIndex);
+
+        // Act
+        var isCompleted = sut.Complete(regionIndex);
+        var result = sut.TryTake(out _);
+
+        // Assert
+        Assert.True(isCompleted);
+        Assert.False(result);
+    }
+
+    [Fact]
+    public void Complete_ShouldReturnFalse_WhenBackupCopyWasCompletedFirst()
+    {
+        // Arrange
+        var sut = new RegionQueue(1);
+        sut.TryTake(out var regionIndex);
+        sut.TryTake(out var backupRegionIndex);
+        sut.Complete(backupRegionIndex);
+
+        // Act
+        var result = sut.Complete(regionIndex);
+
+        // Assert
+        Assert.False(result);
+        Assert.Equal(1, sut.CompletedCount);
+    }
+
+    [Fact]
+    public void TryTake_ShouldReturnFalse_WhenEveryRegionIsCompleted()
+    {
+        // Arrange
+        var sut = new RegionQueue(1);
+        sut.TryTake(out var regionIndex);
+        sut.Complete(regionIndex);
+
+        // Act
+        var result = sut.TryTake(out var takenRegionIndex);
+
+        // Assert
+        Assert.False(result);
+        Assert.Equal(-1, takenRegionIndex);
+    }
+
+    [Fact]
+    public async Task TryTake_ShouldWaitForReleasedRegion_WhenRegionIsOwnedByTwoWorkers()
+    {
+        // Arrange
+        var sut = new RegionQueue(1);
+        sut.TryTake(out var regionIndex);
+        sut.TryTake(out _);
+
+        // Act
+        var task = Task.Run(() => (sut.TryTake(out var takenRegionIndex), takenRegionIndex));
+        var isWaiting = await Task.WhenAny(task, Task.Delay(100)) != task;
+        sut.Release(regionIndex);
+        sut.Release(regionIndex);
+        var (result, takenRegionIndex) = await task;
+
+        // Assert
+        Assert.True(isWaiting);
+        Assert.True(result);
+        Assert.Equal(regionIndex, takenRegionIndex);
+    }
+}
\ No newline at end of file
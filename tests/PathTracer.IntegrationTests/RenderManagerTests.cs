@@ -1,7 +1,12 @@
+using System.Collections.Concurrent;
+
 namespace PathTracer.IntegrationTests;
 
 public class RenderManagerTests
 {
+    private const int RenderWidth = 1280;
+    private const int RenderHeight = 720;
+
     private readonly IRenderManager _sut;
     private readonly IGraphicsService _mockGraphicsService;
     private readonly IRenderer<TextureImage, CommandList> _mockTextureRenderer;
@@ -15,6 +20,10 @@ public class RenderManagerTests
         _mockTextureRenderer = Substitute.For<IRenderer<TextureImage, CommandList>>();
         _mockFileRenderer = Substitute.For<IRenderer<FileImage, string>>();
 
+        // RenderCounters is a class with non virtual members so the mocks can't create it
+        _mockTextureRenderer.Counters.Returns(new RenderCounters());
+        _mockFileRenderer.Counters.Returns(new RenderCounters());
+
         _graphicsDevice = nint.Zero;
         _commandList = nint.Zero;
 
@@ -40,6 +49,36 @@ public class RenderManagerTests
         _mockGraphicsService.Received().CreateTexture(_graphicsDevice, lowResolutionWidth, lowResolutionHeight, 1, 1, 1, TextureFormat.Rgba8UnormSrgb, TextureUsage.Sampled, TextureType.Texture2D);
     }
 
+    [Fact]
+    public void CreateRenderTextures_ShouldDeletePreviousTextures_WhenSizeChanges()
+    {
+        // Arrange
+        CreateRenderTextures();
+
+        // Act
+        _sut.CreateRenderTextures(_graphicsDevice, RenderWidth / 2, RenderHeight / 2);
+
+        // Assert
+        _mockGraphicsService.Received(8).DeleteTexture(Arg.Any<Texture>());
+        Assert.Equal(_sut.CurrentTextureImage.Width, _sut.CurrentTextureImage.AccumulationBuffer.Width);
+        Assert.Equal(RenderWidth / 2 / 8, _sut.CurrentTextureImage.Width);
+    }
+
+    [Fact]
+    public void CreateRenderTextures_ShouldKeepTextures_WhenSizeIsUnchanged()
+    {
+        // Arrange
+        CreateRenderTextures();
+        _mockGraphicsService.ClearReceivedCalls();
+
+        // Act
+        CreateRenderTextures();
+
+        // Assert
+        _mockGraphicsService.DidNotReceiveWithAnyArgs().CreateTexture(default, default, default, default, default, default, default, default, default);
+        _mockGraphicsService.DidNotReceiveWithAnyArgs().DeleteTexture(default);
+    }
+
     [Fact]
     public void Render_ShouldRenderLowResolutionTexture_WhenFirstRendering()
     {
@@ -48,19 +87,128 @@ public class RenderManagerTests
         var scene = CreateScene();
         var camera = new Camera();
 
+        using var renderStarted = new SemaphoreSlim(0);
+        _mockTextureRenderer.When(x => x.Render(Arg.Any<TextureImage>(), Arg.Any<Scene>(), camera, Arg.Any<RenderOptions>(), Arg.Any<CancellationToken>()))
+                            .Do(_ => renderStarted.Release());
+
         // Act
-        _sut.RenderScene(_commandList, scene, camera);
+        _sut.RenderScene(_commandList, scene, camera, new RenderOptions());
 
         // Assert
-        _mockTextureRenderer.Received().Render(new TextureImage(), scene, camera);
+        Assert.True(renderStarted.Wait(TimeSpan.FromSeconds(5)));
+        _mockTextureRenderer.Received().Render(new TextureImage(), Arg.Any<Scene>(), camera, Arg.Any<RenderOptions>(), Arg.Any<CancellationToken>());
     }
 
-    private void CreateRenderTextures()
+    [Fact]
+    public void RenderScene_ShouldStepUpPreviewResolution_WhenPreviewsFitInFrame()
     {
-        var renderWidth = 1280;
-        var renderHeight = 720;
+        // Arrange
+        CreateRenderTextures();
+        var scene = CreateScene();
+        var renderedWidths = new ConcurrentQueue<int>();
 
-        _sut.CreateRenderTextures(_graphicsDevice, renderWidth, renderHeight);
+        _mockTextureRenderer.When(x => x.Render(Arg.Any<TextureImage>(), Arg.Any<Scene>(), Arg.Any<Camera>(), Arg.Any<RenderOptions>(), Arg.Any<CancellationToken>()))
+                            .Do(callInfo => renderedWidths.Enqueue(callInfo.ArgAt<TextureImage>(0).Width));
+
+        // Act
+        _sut.RenderScene(_commandList, scene, new Camera(), new RenderOptions());
+
+        // Assert
+        Assert.True(SpinWait.SpinUntil(() => renderedWidths.Count >= 3, TimeSpan.FromSeconds(5)));
+        Assert.Equal(new[] { RenderWidth / 8, RenderWidth / 4, RenderWidth / 2 }, renderedWidths.Take(3).ToArray());
+    }
+
+    [Fact]
+    public void RenderScene_ShouldUploadLatestRenderedImage_WhenRenderThreadPublishesIt()
+    {
+        // Arrange
+        CreateRenderTextures();
+        var scene = CreateScene();
+        var camera = new Camera();
+
+        // Act
+        _sut.RenderScene(_commandList, scene, camera, new RenderOptions());
+
+        // Keep calling the render loop until the full resolution image is picked up
+        var isFullResolutionUploaded = SpinWait.SpinUntil(() =>
+        {
+            _sut.RenderScene(_commandList, scene, camera, new RenderOptions());
+            return _sut.CurrentTextureImage.Width == RenderWidth;
+        }, TimeSpan.FromSeconds(5));
+
+        // Assert
+        Assert.True(isFullResolutionUploaded);
+        _mockTextureRenderer.Received().CommitImage(Arg.Is<TextureImage>(image => image.Width == RenderWidth), _commandList);
+    }
+
+    [Fact]
+    public void RenderScene_ShouldStartNewFullResolutionRenderWithinOneTile_WhenCameraMoves()
+    {
+        // Arrange
+        const int tileCount = 100;
+
+        CreateRenderTextures();
+        var scene = CreateScene();
+        var camera = new Camera { Position = new Vector3(0.0f, 0.0f, -6.0f) };
+        var movedCamera = camera with { Position = new Vector3(1.0f, 0.0f, -6.0f) };
+
+        using var fullResolutionRenderStarted = new SemaphoreSlim(0);
+        using var tileStarted = new SemaphoreSlim(0);
+        using var nextTile = new SemaphoreSlim(0);
+        var fullResolutionCameras = new ConcurrentQueue<Camera>();
+        var canceledRenderTileCounts = new ConcurrentQueue<int>();
+        var completedTileCount = 0;
+
+        // Simulate a renderer that checks the cancellation token before every tile, each tile
+        // waits for the test to let it complete
+        _mockTextureRenderer.When(x => x.Render(Arg.Is<TextureImage>(image => image.Width == RenderWidth), Arg.Any<Scene>(), Arg.Any<Camera>(), Arg.Any<RenderOptions>(), Arg.Any<CancellationToken>()))
+                            .Do(callInfo =>
+                            {
+                                var cancellationToken = callInfo.ArgAt<CancellationToken>(4);
+
+                                fullResolutionCameras.Enqueue(callInfo.ArgAt<Camera>(2));
+                                fullResolutionRenderStarted.Release();
+
+                                for (var i = 0; i < tileCount; i++)
+                                {
+                                    if (cancellationToken.IsCancellationRequested)
+                                    {
+                                        canceledRenderTileCounts.Enqueue(Volatile.Read(ref completedTileCount));
+                                        cancellationToken.ThrowIfCancellationRequested();
+                                    }
+
+                                    tileStarted.Release();
+                                    nextTile.Wait();
+                                    Interlocked.Increment(ref completedTileCount);
+                                }
+                            });
+
+        _sut.RenderScene(_commandList, scene, camera, new RenderOptions());
+        Assert.True(fullResolutionRenderStarted.Wait(TimeSpan.FromSeconds(5)));
+        Assert.True(tileStarted.Wait(TimeSpan.FromSeconds(5)));
+
+        // Act
+        var cameraMoveTileCount = Volatile.Read(ref completedTileCount);
+        _sut.RenderScene(_commandList, scene, movedCamera, new RenderOptions());
+        nextTile.Release(tileCount * 2);
+
+        // Keep calling the render loop like the application does every frame
+        var isNewRenderStarted = SpinWait.SpinUntil(() =>
+        {
+            _sut.RenderScene(_commandList, scene, movedCamera, new RenderOptions());
+            return fullResolutionRenderStarted.Wait(0);
+        }, TimeSpan.FromSeconds(5));
+
+        // Assert
+        Assert.True(isNewRenderStarted);
+        Assert.Equal(new[] { camera, movedCamera }, fullResolutionCameras.ToArray());
+        Assert.True(canceledRenderTileCounts.TryPeek(out var canceledRenderTileCount));
+        Assert.InRange(canceledRenderTileCount - cameraMoveTileCount, 0, 1);
+    }
+
+    private void CreateRenderTextures()
+    {
+        _sut.CreateRenderTextures(_graphicsDevice, RenderWidth, RenderHeight);
     }
 
     private static Scene CreateScene()
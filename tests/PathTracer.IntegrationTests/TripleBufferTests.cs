@@ -0,0 +1,83 @@
+namespace PathTracer.IntegrationTests;
+
+public class TripleBufferTests
+{
+    private readonly TripleBuffer<int[]> _sut;
+
+    public TripleBufferTests()
+    {
+        _sut = new TripleBuffer<int[]>(new int[1], new int[1], new int[1]);
+    }
+
+    [Fact]
+    public void TryRead_ShouldReturnFalse_WhenNothingWasPublished()
+    {
+        // Act
+        var result = _sut.TryRead(out _);
+
+        // Assert
+        Assert.False(result);
+    }
+
+    [Fact]
+    public void TryRead_ShouldReturnPublishedSlot_WhenSlotWasPublished()
+    {
+        // Arrange
+        _sut.WriteSlot[0] = 1;
+        _sut.Publish();
+
+        // Act
+        var result = _sut.TryRead(out var slot);
+
+        // Assert
+        Assert.True(result);
+        Assert.Equal(1, slot[0]);
+        Assert.False(_sut.TryRead(out _));
+    }
+
+    [Fact]
+    public void TryRead_ShouldReturnLatestSlot_WhenSeveralSlotsWerePublished()
+    {
+        // Arrange
+        for (var i = 1; i <= 5; i++)
+        {
+            _sut.WriteSlot[0] = i;
+            _sut.Publish();
+        }
+
+        // Act
+        var result = _sut.TryRead(out var slot);
+
+        // Assert
+        Assert.True(result);
+        Assert.Equal(5, slot[0]);
+    }
+
+    [Fact]
+    public void WriteSlot_ShouldNotBeReadSlot_WhenSlotWasRead()
+    {
+        // Arrange
+        _sut.Publish();
+        _sut.TryRead(out var readSlot);
+
+        // Act
+        _sut.Publish();
+        var writeSlot = _sut.WriteSlot;
+
+        // Assert
+        Assert.NotSame(readSlot, writeSlot);
+    }
+
+    [Fact]
+    public void Clear_ShouldDropPublishedSlot_WhenSlotWasNotRead()
+    {
+        // Arrange
+        _sut.Publish();
+
+        // Act
+        _sut.Clear();
+
+        // Assert
+        Assert.False(_sut.TryRead(out _));
+    }
+}
\ No newline at end of file